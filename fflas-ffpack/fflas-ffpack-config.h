@@ -156,6 +156,26 @@ namespace std _GLIBCXX_VISIBILITY(default)
 #define __FFLASFFPACK_HAVE_AVX512DQ_INSTRUCTIONS 1
 #endif
 
+/* Define if avx512vl instructions are supported */
+#ifdef __AVX512VL__
+#define __FFLASFFPACK_HAVE_AVX512VL_INSTRUCTIONS 1
+#endif
+
+/* Define if avx512ifma instructions are supported */
+#ifdef __AVX512IFMA__
+#define __FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS 1
+#endif
+
+/* Define if avx512vnni instructions are supported */
+#ifdef __AVX512VNNI__
+#define __FFLASFFPACK_HAVE_AVX512VNNI_INSTRUCTIONS 1
+#endif
+
+/* Define if avx-vnni instructions are supported */
+#ifdef __AVXVNNI__
+#define __FFLASFFPACK_HAVE_AVXVNNI_INSTRUCTIONS 1
+#endif
+
 #endif // CYGWIN and GCC
 
 /* Define if fma instructions are supported */
@@ -45,5 +45,11 @@
 #ifndef __FFLASFFPACK_FSYRK_THRESHOLD
 #define __FFLASFFPACK_FSYRK_THRESHOLD 3000
 #endif
+
+// Minimal number of intermediate reductions in the lazy classic fgemm
+// for the packed kernel to be preferred over the BLAS (0: always packed)
+#ifndef __FFLASFFPACK_PACKED_FGEMM_KBLOCKS
+#define __FFLASFFPACK_PACKED_FGEMM_KBLOCKS 1
+#endif
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
 // vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -67,6 +67,7 @@
 #include "fflas_enum.h"
 
 #include "fflas-ffpack/utils/fflas_memory.h"
+#include "fflas-ffpack/utils/fflas_tuning.h"
 #include "fflas-ffpack/paladin/parallel.h"
 
 //---------------------------------------------------------------------
@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_bitsliced.inl
+ * @brief fgemm and ftrsm over the bit-sliced GF(2) and GF(3).
+ *
+ * fgemm is the method of the Four Russians (M4RM): the rows of op(B) are
+ * taken by groups of Words::grease, whose Q^grease linear combinations are
+ * tabulated, and every row of C then adds one row of each table, indexed by
+ * the digits of the corresponding entries of op(A). ftrsm is recursive,
+ * with its updates done by fgemm, down to blocks of 64 rows or columns solved
+ * by row operations or word dot products.
+ */
+
+#ifndef __FFLASFFPACK_fflas_bitsliced_INL
+#define __FFLASFFPACK_fflas_bitsliced_INL
+
+#include "fflas-ffpack/fflas/fflas_enum.h"
+
+// groups of 64 columns of C computed together, for the tables to stay in cache
+#define __FFLASFFPACK_BITSLICED_COLBLOCK 16
+// tables built and used together, to update C once every TABLES*grease rows of op(B)
+#define __FFLASFFPACK_BITSLICED_TABLES 8
+
+namespace FFLAS { namespace details { /* bit-sliced kernels */
+
+    //! Loads the n <= 64 entries starting at p in w; the entries beyond n are undefined
+    template<size_t P>
+    inline void bs_load (uint64_t* w, const FFPACK::bitsliced_ptr<P>& p, const size_t n)
+    {
+        if (!p._bit) {
+            for (size_t k = 0; k < P; ++k) w[k] = p._ptr[k];
+            return;
+        }
+        for (size_t k = 0; k < P; ++k) w[k] = p._ptr[k] >> p._bit;
+        if (p._bit + n > 64)
+            for (size_t k = 0; k < P; ++k) w[k] |= p._ptr[P+k] << (64 - p._bit);
+    }
+
+    /** Calls op (d, s, mask) on each group of the n entries starting at d, with
+     * s the words of the corresponding entries starting at s, shifted to their
+     * positions in the group of d.
+     */
+    template<size_t P, class Op>
+    inline void bs_rowop (FFPACK::bitsliced_ptr<P> d, FFPACK::bitsliced_ptr<P> s, size_t n, Op op)
+    {
+        uint64_t w[P];
+        while (n) {
+            const size_t b = d._bit, c = std::min (n, 64 - b);
+            const uint64_t mask = ((c == 64) ? ~UINT64_C(0) : ((UINT64_C(1) << c) - 1)) << b;
+            bs_load (w, s, c);
+            for (size_t k = 0; k < P; ++k) w[k] <<= b;
+            op (d._ptr, w, mask);
+            d += c; s += c; n -= c;
+        }
+    }
+
+    //! d <- alpha.s + beta.d
+    template<uint64_t Q>
+    struct bs_axpby {
+        typedef typename FFPACK::BitSliced<Q>::Words Words;
+        const uint8_t alpha, beta;
+        bs_axpby (uint8_t a, uint8_t b) : alpha(a), beta(b) {}
+        inline void operator() (uint64_t* d, const uint64_t* s, const uint64_t mask) const {
+            uint64_t t[Words::planes];
+            for (size_t k = 0; k < Words::planes; ++k) t[k] = d[k];
+            Words::scalin (t, beta);
+            Words::axpyin (t, alpha, s);
+            Words::select (d, t, mask);
+        }
+    };
+
+    //! Row i of the m x n matrix A <- alpha.(row i of B) + beta.(row i of A)
+    template<uint64_t Q>
+    inline void bs_axpby_rows (const FFPACK::BitSliced<Q>& F, const size_t m, const size_t n,
+                               const uint8_t alpha, typename FFPACK::BitSliced<Q>::ConstElement_ptr B, const size_t ldb,
+                               const uint8_t beta, typename FFPACK::BitSliced<Q>::Element_ptr A, const size_t lda)
+    {
+        for (size_t i = 0; i < m; ++i)
+            bs_rowop (A + i*lda, B + i*ldb, n, bs_axpby<Q>(alpha, beta));
+    }
+
+    //! Transposes the 64 x 64 bit matrix a, whose row i is a[i], bit j in column j
+    inline void bs_transpose64 (uint64_t* a)
+    {
+        uint64_t m = UINT64_C(0x00000000FFFFFFFF);
+        for (size_t j = 32; j; j >>= 1, m ^= m << j)
+            for (size_t k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                const uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+                a[k] ^= t << j;
+                a[k | j] ^= t;
+            }
+    }
+
+    //! The n x m matrix T <- the transpose of the m x n matrix A, by 64 x 64 blocks
+    template<uint64_t Q>
+    inline void bs_transpose (const FFPACK::BitSliced<Q>& F, const size_t m, const size_t n,
+                              typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda,
+                              typename FFPACK::BitSliced<Q>::Element_ptr T, const size_t ldt)
+    {
+        const size_t P = FFPACK::BitSliced<Q>::planes;
+        uint64_t blk[P][64], row[P];
+        for (size_t i0 = 0; i0 < m; i0 += 64)
+            for (size_t j0 = 0; j0 < n; j0 += 64) {
+                const size_t mb = std::min (size_t(64), m-i0), nb = std::min (size_t(64), n-j0);
+                for (size_t i = 0; i < 64; ++i) {
+                    if (i < mb) bs_load (row, A + (i0+i)*lda + j0, nb);
+                    for (size_t k = 0; k < P; ++k) blk[k][i] = (i < mb) ? row[k] : 0;
+                }
+                for (size_t k = 0; k < P; ++k) bs_transpose64 (blk[k]);
+                for (size_t j = 0; j < nb; ++j) {
+                    for (size_t k = 0; k < P; ++k) row[k] = blk[k][j];
+                    bs_rowop (T + (j0+j)*ldt + i0, FFPACK::bitsliced_ptr<P>(row), mb, bs_axpby<Q>(1, 0));
+                }
+            }
+    }
+
+    //! Aligned copy of op(A), an m x n matrix: its rows have ld = 64*groups(n) entries
+    template<uint64_t Q>
+    inline typename FFPACK::BitSliced<Q>::Element_ptr
+    bs_copy (const FFPACK::BitSliced<Q>& F, const FFLAS_TRANSPOSE ta, const size_t m, const size_t n,
+             typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda, size_t& ld)
+    {
+        ld = bitsliced_groups (n) << 6;
+        typename FFPACK::BitSliced<Q>::Element_ptr X = fflas_new (F, m, ld);
+        if (ta == FflasNoTrans)
+            bs_axpby_rows (F, m, n, 1, A, lda, 0, X, ld);
+        else
+            bs_transpose (F, n, m, A, lda, X, ld);
+        return X;
+    }
+
+    /** \brief C <- alpha.op(A)*op(B) + beta.C, M4RM.
+     */
+    template<uint64_t Q>
+    inline void fgemm_bitsliced (const FFPACK::BitSliced<Q>& F,
+                                 const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const uint8_t alpha,
+                                 typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda,
+                                 typename FFPACK::BitSliced<Q>::ConstElement_ptr B, const size_t ldb,
+                                 const uint8_t beta,
+                                 typename FFPACK::BitSliced<Q>::Element_ptr C, const size_t ldc)
+    {
+        typedef FFPACK::BitSliced<Q> Field;
+        typedef typename Field::Words Words;
+        typedef typename Field::Element_ptr Element_ptr;
+        const size_t P = Field::planes, G = Field::grease;
+        if (!m || !n) return;
+        if (!k || F.isZero (alpha)) {
+            bs_axpby_rows (F, m, n, 0, C, ldc, beta, C, ldc);
+            return;
+        }
+
+        // op(A) is read in place if possible, op(B) by rows into the tables
+        size_t lda2 = lda, ldb2 = ldb;
+        Element_ptr A2 = (ta == FflasNoTrans) ? A : bs_copy (F, ta, m, k, A, lda, lda2);
+        Element_ptr B2 = (tb == FflasNoTrans) ? B : bs_copy (F, tb, k, n, B, ldb, ldb2);
+
+        size_t QG = 1;
+        for (size_t t = 0; t < G; ++t) QG *= Q;
+        const size_t NT = __FFLASFFPACK_BITSLICED_TABLES;
+        const size_t W = bitsliced_groups (n);
+        const size_t WB = std::min (W, size_t(__FFLASFFPACK_BITSLICED_COLBLOCK));
+        uint64_t* Tab = fflas_new<uint64_t> (NT*QG*WB*P, Alignment::CACHE_LINE);
+        uint64_t* Acc = fflas_new<uint64_t> (m*WB*P, Alignment::CACHE_LINE);
+        size_t idx[__FFLASFFPACK_BITSLICED_TABLES], pw[8];
+        pw[0] = 1;
+        for (size_t t = 1; t < G; ++t) pw[t] = Q*pw[t-1];
+
+        for (size_t w0 = 0; w0 < W; w0 += WB) {
+            const size_t wb = std::min (WB, W-w0), cols = std::min (wb << 6, n - (w0 << 6));
+            const size_t rw = wb*P; // words of a row of a table or of Acc
+            std::fill (Acc, Acc + m*rw, UINT64_C(0));
+            for (size_t l0 = 0; l0 < k; l0 += NT*G) {
+                // the tables of the next NT groups of rows of op(B)
+                const size_t nt = std::min (NT, (k - l0 + G - 1) / G);
+                for (size_t t = 0; t < nt; ++t) {
+                    uint64_t* T = Tab + t*QG*rw;
+                    const size_t g = std::min (G, k - l0 - t*G);
+                    std::fill (T, T + rw, UINT64_C(0));
+                    for (size_t r = 0; r < g; ++r)
+                        bs_axpby_rows (F, 1, cols, 1, B2 + (l0+t*G+r)*ldb2 + (w0 << 6), ldb2, 0, Element_ptr(T + pw[r]*rw), 0);
+                    for (size_t x = 2; x < pw[g-1]*Q; ++x) {
+                        size_t r = 0;
+                        while ((x / pw[r]) % Q == 0) ++r;
+                        const uint8_t d = uint8_t((x / pw[r]) % Q);
+                        if (d == 1 && x == pw[r]) continue; // row r of op(B)
+                        uint64_t* Tx = T + x*rw;
+                        const uint64_t* Ty = T + (x - d*pw[r])*rw;
+                        const uint64_t* Tr = T + pw[r]*rw;
+                        for (size_t w = 0; w < rw; w += P) {
+                            for (size_t p = 0; p < P; ++p) Tx[w+p] = Ty[w+p];
+                            Words::axpyin (Tx+w, d, Tr+w);
+                        }
+                    }
+                }
+                for (size_t i = 0; i < m; ++i) {
+                    uint64_t a[P];
+                    for (size_t t = 0; t < nt; ++t) {
+                        const size_t g = std::min (G, k - l0 - t*G);
+                        bs_load (a, A2 + i*lda2 + l0 + t*G, g);
+                        idx[t] = Words::index (a, g);
+                    }
+                    uint64_t* Ci = Acc + i*rw;
+                    for (size_t t = 0; t < nt; ++t) {
+                        if (!idx[t]) continue;
+                        const uint64_t* Tx = Tab + (t*QG + idx[t])*rw;
+                        for (size_t w = 0; w < rw; w += P)
+                            Words::axpyin (Ci+w, 1, Tx+w);
+                    }
+                }
+            }
+            for (size_t i = 0; i < m; ++i)
+                bs_rowop (C + i*ldc + (w0 << 6), Element_ptr(Acc + i*rw), cols, bs_axpby<Q>(alpha, beta));
+        }
+        fflas_delete (Tab, Acc);
+        if (ta != FflasNoTrans) fflas_delete (A2);
+        if (tb != FflasNoTrans) fflas_delete (B2);
+    }
+
+    //! B <- T^-1 B, with T an m x m triangular matrix with aligned rows and an invertible diagonal
+    template<uint64_t Q>
+    inline void bs_trsm_left (const FFPACK::BitSliced<Q>& F, const FFLAS_UPLO uplo, const size_t m, const size_t n,
+                              typename FFPACK::BitSliced<Q>::ConstElement_ptr T, const size_t ldt,
+                              typename FFPACK::BitSliced<Q>::Element_ptr B, const size_t ldb)
+    {
+        typedef typename FFPACK::BitSliced<Q>::Element Element;
+        if (m <= 64) {
+            for (size_t s = 0; s < m; ++s) {
+                const size_t i = (uplo == FflasLower) ? s : m-1-s;
+                const size_t j0 = (uplo == FflasLower) ? 0 : i+1, j1 = (uplo == FflasLower) ? i : m;
+                for (size_t j = j0; j < j1; ++j) {
+                    Element c = T[i*ldt+j];
+                    if (c) bs_rowop (B + i*ldb, B + j*ldb, n, bs_axpby<Q>(F.neg (c, c), 1));
+                }
+                Element d = T[i*ldt+i];
+                if (!F.isOne (d)) bs_rowop (B + i*ldb, B + i*ldb, n, bs_axpby<Q>(0, F.inv (d, d)));
+            }
+            return;
+        }
+        const size_t m1 = ((m/2 + 63) >> 6) << 6, m2 = m - m1;
+        if (uplo == FflasLower) {
+            bs_trsm_left (F, uplo, m1, n, T, ldt, B, ldb);
+            fgemm_bitsliced (F, FflasNoTrans, FflasNoTrans, m2, n, m1, F.mOne, T + m1*ldt, ldt, B, ldb, F.one, B + m1*ldb, ldb);
+            bs_trsm_left (F, uplo, m2, n, T + m1*(ldt+1), ldt, B + m1*ldb, ldb);
+        } else {
+            bs_trsm_left (F, uplo, m2, n, T + m1*(ldt+1), ldt, B + m1*ldb, ldb);
+            fgemm_bitsliced (F, FflasNoTrans, FflasNoTrans, m1, n, m2, F.mOne, T + m1, ldt, B + m1*ldb, ldb, F.one, B, ldb);
+            bs_trsm_left (F, uplo, m1, n, T, ldt, B, ldb);
+        }
+    }
+
+    //! B <- B T^-1, with T an n x n triangular matrix with aligned rows and an invertible diagonal
+    template<uint64_t Q>
+    inline void bs_trsm_right (const FFPACK::BitSliced<Q>& F, const FFLAS_UPLO uplo, const size_t m, const size_t n,
+                               typename FFPACK::BitSliced<Q>::ConstElement_ptr T, const size_t ldt,
+                               typename FFPACK::BitSliced<Q>::Element_ptr B, const size_t ldb)
+    {
+        typedef FFPACK::BitSliced<Q> Field;
+        typedef typename Field::Words Words;
+        typedef typename Field::Element Element;
+        const size_t P = Field::planes;
+        if (n <= 64) {
+            // the columns of T as words, and their inverted diagonal
+            uint64_t col[P][64], x[P], c[P];
+            Element dinv[64];
+            for (size_t i = 0; i < 64; ++i) {
+                if (i < n) bs_load (x, T + i*ldt, n);
+                for (size_t p = 0; p < P; ++p) col[p][i] = (i < n) ? x[p] : 0;
+            }
+            for (size_t p = 0; p < P; ++p) bs_transpose64 (col[p]);
+            for (size_t j = 0; j < n; ++j) { Element d = T[j*ldt+j]; F.inv (dinv[j], d); }
+            for (size_t i = 0; i < m; ++i) {
+                bs_load (x, B + i*ldb, n);
+                for (size_t s = 0; s < n; ++s) {
+                    const size_t j = (uplo == FflasUpper) ? s : n-1-s;
+                    // entries of x already solved: before j if T is upper, after j if lower
+                    const uint64_t below = (UINT64_C(1) << j) - 1;
+                    const uint64_t mask = (uplo == FflasUpper) ? below : ~below & ~(UINT64_C(1) << j);
+                    for (size_t p = 0; p < P; ++p) c[p] = col[p][j];
+                    Element v;
+                    F.sub (v, Words::get (x, j), Words::dot (x, c, mask));
+                    Words::set (x, j, F.mulin (v, dinv[j]));
+                }
+                bs_rowop (B + i*ldb, FFPACK::bitsliced_ptr<P>(x), n, bs_axpby<Q>(1, 0));
+            }
+            return;
+        }
+        const size_t n1 = ((n/2 + 63) >> 6) << 6, n2 = n - n1;
+        if (uplo == FflasUpper) {
+            bs_trsm_right (F, uplo, m, n1, T, ldt, B, ldb);
+            fgemm_bitsliced (F, FflasNoTrans, FflasNoTrans, m, n2, n1, F.mOne, B, ldb, T + n1, ldt, F.one, B + n1, ldb);
+            bs_trsm_right (F, uplo, m, n2, T + n1*(ldt+1), ldt, B + n1, ldb);
+        } else {
+            bs_trsm_right (F, uplo, m, n2, T + n1*(ldt+1), ldt, B + n1, ldb);
+            fgemm_bitsliced (F, FflasNoTrans, FflasNoTrans, m, n1, n2, F.mOne, B + n1, ldb, T + n1*ldt, ldt, F.one, B, ldb);
+            bs_trsm_right (F, uplo, m, n1, T, ldt, B, ldb);
+        }
+    }
+
+    /** \brief B <- alpha.op(A)^-1 B (Left) or alpha.B op(A)^-1 (Right).
+     *
+     * op(A) is copied with aligned rows, and its unit diagonal made explicit.
+     */
+    template<uint64_t Q>
+    inline void ftrsm_bitsliced (const FFPACK::BitSliced<Q>& F, const FFLAS_SIDE side, const FFLAS_UPLO uplo,
+                                 const FFLAS_TRANSPOSE ta, const FFLAS_DIAG diag,
+                                 const size_t m, const size_t n, const uint8_t alpha,
+                                 typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda,
+                                 typename FFPACK::BitSliced<Q>::Element_ptr B, const size_t ldb)
+    {
+        if (!m || !n) return;
+        if (!F.isOne (alpha))
+            bs_axpby_rows (F, m, n, 0, B, ldb, alpha, B, ldb);
+        if (F.isZero (alpha)) return;
+        const size_t K = (side == FflasLeft) ? m : n;
+        size_t ldt;
+        typename FFPACK::BitSliced<Q>::Element_ptr T = bs_copy (F, ta, K, K, A, lda, ldt);
+        if (diag == FflasUnit)
+            for (size_t i = 0; i < K; ++i) T[i*ldt+i] = F.one;
+        const FFLAS_UPLO up = (ta == FflasNoTrans) ? uplo : ((uplo == FflasUpper) ? FflasLower : FflasUpper);
+        if (side == FflasLeft)
+            bs_trsm_left (F, up, m, n, T, ldt, B, ldb);
+        else
+            bs_trsm_right (F, up, m, n, T, ldt, B, ldb);
+        fflas_delete (T);
+    }
+
+} // details
+} // FFLAS
+
+namespace FFLAS {
+
+    template<uint64_t Q>
+    inline typename FFPACK::BitSliced<Q>::Element_ptr
+    fgemm (const FFPACK::BitSliced<Q>& F, const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+           const size_t m, const size_t n, const size_t k,
+           const typename FFPACK::BitSliced<Q>::Element alpha,
+           typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda,
+           typename FFPACK::BitSliced<Q>::ConstElement_ptr B, const size_t ldb,
+           const typename FFPACK::BitSliced<Q>::Element beta,
+           typename FFPACK::BitSliced<Q>::Element_ptr C, const size_t ldc)
+    {
+        details::fgemm_bitsliced (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        return C;
+    }
+
+    template<uint64_t Q>
+    inline void
+    ftrsm (const FFPACK::BitSliced<Q>& F, const FFLAS_SIDE side, const FFLAS_UPLO uplo,
+           const FFLAS_TRANSPOSE ta, const FFLAS_DIAG diag, const size_t m, const size_t n,
+           const typename FFPACK::BitSliced<Q>::Element alpha,
+           typename FFPACK::BitSliced<Q>::ConstElement_ptr A, const size_t lda,
+           typename FFPACK::BitSliced<Q>::Element_ptr B, const size_t ldb)
+    {
+        details::ftrsm_bitsliced (F, side, uplo, ta, diag, m, n, alpha, A, lda, B, ldb);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_bitsliced_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
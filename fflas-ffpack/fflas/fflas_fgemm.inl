@@ -32,6 +32,9 @@
 #include <givaro/modular.h>
 #include <givaro/modular-balanced.h>
 #include "fflas-ffpack/utils/debug.h"
+#if defined(__FFLASFFPACK_HAVE_AVX2_INSTRUCTIONS) and (defined(__FFLASFFPACK_HAVE_AVXVNNI_INSTRUCTIONS) or (defined(__FFLASFFPACK_HAVE_AVX512VNNI_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_AVX512VL_INSTRUCTIONS)))
+#include "fflas-ffpack/fflas/fflas_fgemm/fgemm_vnni.inl"
+#endif
 
 namespace FFLAS { namespace Protected{
 
@@ -63,9 +66,9 @@ namespace FFLAS { namespace Protected{
         F.convert (tmp, alpha);
         G.init(alphaf, tmp);
 
-        FloatElement* Af = FFLAS::fflas_new(G, m, k);
-        FloatElement* Bf = FFLAS::fflas_new(G, k, n);
-        FloatElement* Cf = FFLAS::fflas_new(G, m, n);
+        FloatElement* Af = FFLAS::workspace_new(G, m, k, H.WS);
+        FloatElement* Bf = FFLAS::workspace_new(G, k, n, H.WS);
+        FloatElement* Cf = FFLAS::workspace_new(G, m, n, H.WS);
 
         size_t ma, ka, kb, nb; //mb, na
         if (ta == FflasTrans) { ma = k; ka = m; }
@@ -84,13 +87,12 @@ namespace FFLAS { namespace Protected{
             freduce (G, m, n, Cf, n);
         }
         MMHelper<NewField, MMHelperAlgo::Winograd> HG(G,H.recLevel, ParSeqHelper::Sequential());
+        HG.WS = H.WS;
         fgemm (G, ta, tb, m, n, k, alphaf, Af, ldaf, Bf, ldbf, betaf, Cf, ldcf, HG);
 
         finit (F, m, n, Cf, n, C, ldc);
 
-        fflas_delete (Af);
-        fflas_delete (Bf);
-        fflas_delete (Cf);
+        workspace_delete (H.WS, Af, Bf, Cf);
         return C;
     }
 }//Protected
@@ -251,6 +253,12 @@ namespace FFLAS {
            typename Field::Element_ptr C, const size_t ldc,
            MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::ConvertTo<ElementCategories::MachineFloatTag>, ParSeqHelper::Sequential> & H)
     {
+#if defined(__FFLASFFPACK_HAVE_AVX2_INSTRUCTIONS) and (defined(__FFLASFFPACK_HAVE_AVXVNNI_INSTRUCTIONS) or (defined(__FFLASFFPACK_HAVE_AVX512VNNI_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_AVX512VL_INSTRUCTIONS)))
+        // 8 and 16-bit fields: 16-bit products accumulated in 32 bits, rather than a conversion to floating point
+        if (Protected::fgemm_vnni (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc,
+                                   typename Protected::VnniFgemmSupport<Field>::type()))
+            return C;
+#endif
         if (!std::is_same<Field,Givaro::Modular<float> >::value){
             if (F.cardinality() == 2)
                 return Protected::fgemm_convert<Givaro::Modular<float>,Field>(F,ta,tb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,H);
@@ -439,6 +447,9 @@ namespace FFLAS {
 // #include "fflas_fgemm/matmul_algos.inl"
 #include "fflas_fgemm/fgemm_classical.inl"
 #include "fflas_fgemm/fgemm_winograd.inl"
+#include "fflas_fgemm/fgemm_batched.inl"
+#include "fflas_fgemm/fgemm_prepared.inl"
+#include "fflas_fgemm/fgemm_workspace.inl"
 // #include "fflas_fgemm/gemm_bini.inl"
 
 // fsquare
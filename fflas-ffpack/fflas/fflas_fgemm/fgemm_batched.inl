@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_fgemm/fgemm_batched.inl
+ * @brief Batches of independent small matrix products sharing dimensions and scalars.
+ *
+ * The helper, the reduction parameters and the packing buffers are set up once
+ * for a whole range of the batch, instead of once per product. Over the
+ * fields supported by the packed kernel, each product then goes straight to
+ * the packed micro-kernels, without any BLAS dispatch.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_batched_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_batched_INL
+
+namespace FFLAS { namespace Protected {
+
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+    /** \brief Runs the products begin..end-1 of a batch with the packed kernel.
+     * Inputs are assumed reduced. Returns false if the kernel can not be used.
+     */
+    template<class Field, class AOf, class BOf, class COf>
+    inline bool fgemm_batched_packed (const Field& F,
+                                      const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const typename Field::Element alpha,
+                                      AOf Aof, const size_t lda, BOf Bof, const size_t ldb,
+                                      const typename Field::Element beta,
+                                      COf Cof, const size_t ldc,
+                                      const size_t begin, const size_t end, std::true_type)
+    {
+        typedef MMHelper<Field, MMHelperAlgo::Classic, ModeCategories::LazyTag> HelperType;
+        typedef typename HelperType::DFElt DFElt;
+        typedef typename Field::Element T;
+        typedef Simd<T> simd;
+
+        HelperType H (F, 0);
+        DFElt alphadf, betadf;
+        packed_scalars (F, H, alpha, beta, alphadf, betadf);
+
+        const size_t kmaxfirst = H.MaxDelayedDim (betadf);
+        const size_t kmax = H.MaxDelayedDim (DFElt(1));
+        if (!kmaxfirst || !kmax)
+            return false;
+
+        const bool scal = !F.isOne (alpha) && !F.isMOne (alpha);
+        T al; F.convert (al, alpha);
+        details::PackedReduction<T> Red (F, al, (T)betadf, alphadf < 0, scal);
+        details::PackedBlocking<T> Blk (m, n, k, kmaxfirst, kmax);
+        T* blockA = fflas_new<T> (Blk.sizeA, (Alignment)simd::alignment);
+        T* blockB = fflas_new<T> (Blk.sizeB, (Alignment)simd::alignment);
+        for (size_t i = begin; i < end; ++i)
+            details::fgemm_packed (F, ta, tb, m, n, k, Aof(i), lda, Bof(i), ldb, Cof(i), ldc, Red, Blk, blockA, blockB);
+        fflas_delete (blockA, blockB);
+        return true;
+    }
+
+    template<class Field, class AOf, class BOf, class COf>
+    inline bool fgemm_batched_packed (const Field& F,
+                                      const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const typename Field::Element alpha,
+                                      AOf Aof, const size_t lda, BOf Bof, const size_t ldb,
+                                      const typename Field::Element beta,
+                                      COf Cof, const size_t ldc,
+                                      const size_t begin, const size_t end, std::false_type)
+    {
+        return false;
+    }
+#endif
+
+    /** \brief Computes the products begin..end-1 of a batch, sequentially.
+    */
+    template<class Field, class AOf, class BOf, class COf>
+    inline void fgemm_batched_range (const Field& F,
+                                     const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const typename Field::Element alpha,
+                                     AOf Aof, const size_t lda, BOf Bof, const size_t ldb,
+                                     const typename Field::Element beta,
+                                     COf Cof, const size_t ldc,
+                                     const size_t begin, const size_t end)
+    {
+        if (!k || F.isZero (alpha)){
+            for (size_t i = begin; i < end; ++i)
+                fscalin (F, m, n, beta, Cof(i), ldc);
+            return;
+        }
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        if (fgemm_batched_packed (F, ta, tb, m, n, k, alpha, Aof, lda, Bof, ldb, beta, Cof, ldc, begin, end,
+                                  typename PackedFgemmSupport<Field>::type()))
+            return;
+#endif
+        typedef MMHelper<Field, MMHelperAlgo::Auto, typename FFLAS::ModeTraits<Field>::value, ParSeqHelper::Sequential> HelperType;
+        HelperType H (F, m, k, n, ParSeqHelper::Sequential());
+        for (size_t i = begin; i < end; ++i) {
+            HelperType Hi (H);
+            fgemm (F, ta, tb, m, n, k, alpha, Aof(i), lda, Bof(i), ldb, beta, Cof(i), ldc, Hi);
+        }
+    }
+
+    template<class Field, class AOf, class BOf, class COf>
+    inline void fgemm_batched (const Field& F,
+                               const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                               const size_t m, const size_t n, const size_t k,
+                               const typename Field::Element alpha,
+                               AOf Aof, const size_t lda, BOf Bof, const size_t ldb,
+                               const typename Field::Element beta,
+                               COf Cof, const size_t ldc,
+                               const size_t batchcount, const ParSeqHelper::Sequential)
+    {
+        fgemm_batched_range (F, ta, tb, m, n, k, alpha, Aof, lda, Bof, ldb, beta, Cof, ldc, 0, batchcount);
+    }
+
+    template<class Field, class AOf, class BOf, class COf, class Cut, class Param>
+    inline void fgemm_batched (const Field& F,
+                               const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                               const size_t m, const size_t n, const size_t k,
+                               const typename Field::Element alpha,
+                               AOf Aof, const size_t lda, BOf Bof, const size_t ldb,
+                               const typename Field::Element beta,
+                               COf Cof, const size_t ldc,
+                               const size_t batchcount, const ParSeqHelper::Parallel<Cut,Param> par)
+    {
+        if (par.numthreads() <= 1 || batchcount <= 1)
+            return fgemm_batched_range (F, ta, tb, m, n, k, alpha, Aof, lda, Bof, ldb, beta, Cof, ldc, 0, batchcount);
+
+        SYNCH_GROUP(
+                    FORBLOCK1D(iter, batchcount, SPLITTER(par.numthreads(), Cut, Param),
+                               TASK(MODE(CONSTREFERENCE(F, Aof, Bof, Cof)),
+                                    { fgemm_batched_range (F, ta, tb, m, n, k, alpha, Aof, lda, Bof, ldb, beta, Cof, ldc,
+                                                           iter.begin(), iter.end()); }
+                                   );
+                              );
+                   );
+    }
+
+} // Protected
+} // FFLAS
+
+namespace FFLAS {
+
+    template<class Field, class ParSeqTrait>
+    inline void
+    fgemm_batched (const Field& F,
+                   const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                   const size_t m, const size_t n, const size_t k,
+                   const typename Field::Element alpha,
+                   typename Field::ConstElement_ptr const * A, const size_t lda,
+                   typename Field::ConstElement_ptr const * B, const size_t ldb,
+                   const typename Field::Element beta,
+                   typename Field::Element_ptr const * C, const size_t ldc,
+                   const size_t batchcount, const ParSeqTrait par)
+    {
+        if (!m || !n || !batchcount) return;
+        Protected::fgemm_batched (F, ta, tb, m, n, k, alpha,
+                                  [A](size_t i) { return A[i]; }, lda,
+                                  [B](size_t i) { return B[i]; }, ldb,
+                                  beta,
+                                  [C](size_t i) { return C[i]; }, ldc,
+                                  batchcount, par);
+    }
+
+    template<class Field>
+    inline void
+    fgemm_batched (const Field& F,
+                   const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                   const size_t m, const size_t n, const size_t k,
+                   const typename Field::Element alpha,
+                   typename Field::ConstElement_ptr const * A, const size_t lda,
+                   typename Field::ConstElement_ptr const * B, const size_t ldb,
+                   const typename Field::Element beta,
+                   typename Field::Element_ptr const * C, const size_t ldc,
+                   const size_t batchcount)
+    {
+        fgemm_batched (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchcount, ParSeqHelper::Sequential());
+    }
+
+    template<class Field, class ParSeqTrait>
+    inline void
+    fgemm_strided_batched (const Field& F,
+                           const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                           const size_t m, const size_t n, const size_t k,
+                           const typename Field::Element alpha,
+                           typename Field::ConstElement_ptr A, const size_t lda, const size_t strideA,
+                           typename Field::ConstElement_ptr B, const size_t ldb, const size_t strideB,
+                           const typename Field::Element beta,
+                           typename Field::Element_ptr C, const size_t ldc, const size_t strideC,
+                           const size_t batchcount, const ParSeqTrait par)
+    {
+        if (!m || !n || !batchcount) return;
+        Protected::fgemm_batched (F, ta, tb, m, n, k, alpha,
+                                  [A,strideA](size_t i) { return A + i*strideA; }, lda,
+                                  [B,strideB](size_t i) { return B + i*strideB; }, ldb,
+                                  beta,
+                                  [C,strideC](size_t i) { return C + i*strideC; }, ldc,
+                                  batchcount, par);
+    }
+
+    template<class Field>
+    inline void
+    fgemm_strided_batched (const Field& F,
+                           const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                           const size_t m, const size_t n, const size_t k,
+                           const typename Field::Element alpha,
+                           typename Field::ConstElement_ptr A, const size_t lda, const size_t strideA,
+                           typename Field::ConstElement_ptr B, const size_t ldb, const size_t strideB,
+                           const typename Field::Element beta,
+                           typename Field::Element_ptr C, const size_t ldc, const size_t strideC,
+                           const size_t batchcount)
+    {
+        fgemm_strided_batched (F, ta, tb, m, n, k, alpha, A, lda, strideA, B, ldb, strideB,
+                               beta, C, ldc, strideC, batchcount, ParSeqHelper::Sequential());
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_batched_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
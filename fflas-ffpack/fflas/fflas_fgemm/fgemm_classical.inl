@@ -40,6 +40,12 @@
 #if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS) and defined(__x86_64__)
 #include "fflas-ffpack/fflas/fflas_igemm/igemm.h"
 #endif
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+#include "fflas-ffpack/fflas/fflas_fgemm/fgemm_packed.inl"
+#endif
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128) and defined(__x86_64__)
+#include "fflas-ffpack/fflas/fflas_fgemm/fgemm_ifma.inl"
+#endif
 
 namespace FFLAS {
 
@@ -105,6 +111,14 @@ namespace FFLAS {
             return fgemm (F, ta, tb, m,n,k,alpha, A, lda, B, ldb, beta, C, ldc, HG);
         }
 
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        // Several k-blocks: fuse the intermediate reductions in the packed kernel
+        // instead of sweeping C between each BLAS call
+        if (Protected::fgemm_packed (F, ta, tb, m, n, k, alpha, alphadf, betadf, A, lda, B, ldb, C, ldc, kmax, H,
+                                     typename Protected::PackedFgemmSupport<Field>::type()))
+            return;
+#endif
+
         size_t k2 = std::min(k,kmax);
         size_t nblock = k / kmax;
         size_t remblock = k % kmax;
@@ -194,6 +208,12 @@ namespace FFLAS {
             fscalin(F, m, n, beta, C, ldc);
             return;
         }
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128) and defined(__x86_64__)
+        // 64-bit fields with a modulus below 2^52: one reduction per igemm52_kmax products
+        if (Protected::fgemm_ifma (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, H.WS,
+                                   typename Protected::IfmaFgemmSupport<Field>::type()))
+            return;
+#endif
         // Standard algorithm is performed over the Field, without conversion
         if (F.isZero (beta))
             fzero (F, m, n, C, ldc);
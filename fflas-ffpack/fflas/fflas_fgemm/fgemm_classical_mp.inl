@@ -52,6 +52,8 @@ namespace FFLAS {
         Givaro::Integer normA,normB;
         int recLevel;
         ParSeqTrait parseq;
+        size_t WorkspaceBudget = std::numeric_limits<size_t>::max(); // unused by the RNS fgemm
+        Workspace* WS = nullptr;
         MMHelper() : normA(0), normB(0), recLevel(-1) {}
         template <class F2, class A2, class M2, class PS2>
         MMHelper(MMHelper<F2, A2, M2, PS2> H2) :
@@ -81,6 +83,8 @@ namespace FFLAS {
         Givaro::Integer normA,normB;
         int recLevel;
         ParSeqTrait parseq;
+        size_t WorkspaceBudget = std::numeric_limits<size_t>::max(); // unused by the RNS fgemm
+        Workspace* WS = nullptr;
         MMHelper() : normA(0), normB(0), recLevel(-1) {}
         MMHelper(Givaro::Integer Amax, Givaro::Integer Bmax) : normA(Amax), normB(Bmax), recLevel(-1) {}
         MMHelper(const FFPACK::RNSInteger<E>& F, size_t m, size_t n, size_t k, ParSeqTrait PS=ParSeqTrait())
@@ -111,6 +115,8 @@ namespace FFLAS {
         Givaro::Integer normA,normB;
         int recLevel;
         ParSeqTrait parseq;
+        size_t WorkspaceBudget = std::numeric_limits<size_t>::max(); // unused by the RNS fgemm
+        Workspace* WS = nullptr;
         MMHelper() : normA(0), normB(0), recLevel(-1) {}
         MMHelper(Givaro::Integer Amax, Givaro::Integer Bmax) : normA(Amax), normB(Bmax), recLevel(-1) {}
         MMHelper(const FFPACK::RNSIntegerMod<E>& F, size_t m, size_t n, size_t k, ParSeqTrait PS=ParSeqTrait())
@@ -235,6 +241,9 @@ namespace FFLAS {
     }
 
     // fgemm for RnsInteger default parallel version
+    // With fewer moduli than threads, the products are scheduled as a
+    // (modulus x block) grid of sequential tasks, the blocks cutting the
+    // larger dimension of C, so that few moduli on large matrices still scale.
     template<typename RNS, typename Cut, typename Param>
     inline  typename FFPACK::RNSInteger<RNS>::Element_ptr
     fgemm (const FFPACK::RNSInteger<RNS> &F,
@@ -248,55 +257,63 @@ namespace FFLAS {
            typename FFPACK::RNSInteger<RNS>::Element_ptr Cd, const size_t ldc,
            MMHelper<FFPACK::RNSInteger<RNS>, MMHelperAlgo::Classic, ModeCategories::DefaultTag, ParSeqHelper::Parallel<Cut,Param> > & H)
     {
-        // compute each fgemm componentwise
         size_t rns_size = F.size();
         size_t nt = H.parseq.numthreads();
-        size_t loop_nt = std::min (rns_size, nt);
-        size_t iter_nt = nt / loop_nt;
-        size_t leftover_nt = nt % loop_nt;
-        ParSeqHelper::Parallel<CuttingStrategy::RNSModulus, StrategyParameter::Threads> Hloop (loop_nt);
 #ifdef PROFILE_FGEMM_MP
         Givaro::Timer t;t.start();
 #endif
-        typedef MMHelper<typename RNS::ModField,
-                MMHelperAlgo::Winograd,
-                typename ModeTraits<typename RNS::ModField>::value,
-                ParSeqHelper::Parallel<Cut,Param> > SubPar;
-
         typedef MMHelper<typename RNS::ModField,
                 MMHelperAlgo::Winograd,
                 typename ModeTraits<typename RNS::ModField>::value,
                 ParSeqHelper::Sequential> SubSeq;
 
-        FORBLOCK1D(iter, rns_size, Hloop,
-                   TASK(MODE(CONSTREFERENCE(F,H)),
-                        {
-                        for(auto i=iter.begin(); i!=iter.end(); ++i)
-                        {
-                        size_t fgemm_nt = iter_nt;
-                        if (i < leftover_nt)
-                        fgemm_nt++;
-                        if (fgemm_nt>1) // Running a parallel fgemm
-                        {
-                        SubPar H2(F.rns()._field_rns[i], H.recLevel, ParSeqHelper::Parallel<Cut,Param>(fgemm_nt));
-                        fgemm(F.rns()._field_rns[i], ta, tb, m, n, k,
-                              alpha._ptr[i*alpha._stride], Ad._ptr+i*Ad._stride,
-                              lda, Bd._ptr+i*Bd._stride, ldb,
-                              beta._ptr[i*beta._stride], Cd._ptr+i*Cd._stride,
-                              ldc, H2);
-                        }
-                        else // Running a sequential fgemm
-                        {
-                        SubSeq H2(F.rns()._field_rns[i], H.recLevel, ParSeqHelper::Sequential());
-                        fgemm(F.rns()._field_rns[i], ta, tb, m, n, k,
-                              alpha._ptr[i*alpha._stride], Ad._ptr+i*Ad._stride,
-                              lda, Bd._ptr+i*Bd._stride, ldb,
-                              beta._ptr[i*beta._stride], Cd._ptr+i*Cd._stride,
-                              ldc, H2);
-                        }
+        if (nt <= rns_size) {
+            // compute each fgemm componentwise
+            ParSeqHelper::Parallel<CuttingStrategy::RNSModulus, StrategyParameter::Threads> Hloop (nt);
+            SYNCH_GROUP(
+                        FORBLOCK1D(iter, rns_size, Hloop,
+                                   TASK(MODE(CONSTREFERENCE(F,H)),
+                                        {
+                                        for(auto i=iter.begin(); i!=iter.end(); ++i)
+                                        {
+                                        SubSeq H2(F.rns()._field_rns[i], H.recLevel, ParSeqHelper::Sequential());
+                                        fgemm(F.rns()._field_rns[i], ta, tb, m, n, k,
+                                              alpha._ptr[i*alpha._stride], Ad._ptr+i*Ad._stride,
+                                              lda, Bd._ptr+i*Bd._stride, ldb,
+                                              beta._ptr[i*beta._stride], Cd._ptr+i*Cd._stride,
+                                              ldc, H2);
+                                        }
+                                        }); // TASK
+                                  ); // FORBLOCK1D
+                       );
+        } else {
+            // (modulus x block) grid: the blocks of rows of A and C, or of columns of B and C
+            const bool rows = (m >= n);
+            const size_t dim = rows ? m : n;
+            const size_t blocks = std::min ((nt+rns_size-1)/rns_size, dim);
+            const size_t sa = rows ? ((ta==FflasNoTrans) ? lda : 1) : 0;
+            const size_t sb = rows ? 0 : ((tb==FflasNoTrans) ? 1 : ldb);
+            const size_t sc = rows ? ldc : 1;
+            ParSeqHelper::Parallel<CuttingStrategy::Block, StrategyParameter::Threads> Hgrid (blocks);
+            SYNCH_GROUP(
+                        for (size_t i=0; i<rns_size; ++i) {
+                        FORBLOCK1D(iter, dim, Hgrid,
+                                   TASK(MODE(CONSTREFERENCE(F,H)),
+                                        {
+                                        const size_t b = iter.begin();
+                                        const size_t len = iter.end()-b;
+                                        SubSeq H2(F.rns()._field_rns[i], H.recLevel, ParSeqHelper::Sequential());
+                                        fgemm(F.rns()._field_rns[i], ta, tb,
+                                              rows ? len : m, rows ? n : len, k,
+                                              alpha._ptr[i*alpha._stride], Ad._ptr+i*Ad._stride+b*sa,
+                                              lda, Bd._ptr+i*Bd._stride+b*sb, ldb,
+                                              beta._ptr[i*beta._stride], Cd._ptr+i*Cd._stride+b*sc,
+                                              ldc, H2);
+                                        }); // TASK
+                                  ); // FORBLOCK1D
                         }
-                        }); // TASK
-        ); // FLORBLOCK1D
+                       );
+        }
 
 #ifdef PROFILE_FGEMM_MP
         t.stop();
@@ -382,8 +399,8 @@ namespace FFLAS {
 #endif
 
         // convert the input matrices to RNS representation
-        finit_rns(Zrns,Arowd,Acold,(logA/16)+((logA%16)?1:0),A,lda,Ap);
-        finit_rns(Zrns,Browd,Bcold,(logB/16)+((logB%16)?1:0),B,ldb,Bp);
+        finit_rns(Zrns,Arowd,Acold,(logA/16)+((logA%16)?1:0),A,lda,Ap,H.parseq);
+        finit_rns(Zrns,Browd,Bcold,(logB/16)+((logB%16)?1:0),B,ldb,Bp,H.parseq);
 
 #ifdef PROFILE_FGEMM_MP
         chrono.stop();
@@ -411,7 +428,7 @@ namespace FFLAS {
 
 
         // convert the RNS output to integer representation (C=beta.C+ RNS^(-1)(Cp) )
-        fconvert_rns(Zrns,m,n,beta,C,ldc,Cp);
+        fconvert_rns(Zrns,m,n,beta,C,ldc,Cp,H.parseq);
 
         FFLAS::fflas_delete(Ap);
         FFLAS::fflas_delete(Bp);
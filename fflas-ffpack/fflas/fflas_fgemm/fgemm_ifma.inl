@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas_fgemm/fgemm_ifma.inl
+ * @brief Classic fgemm over 64-bit integer fields with the AVX512IFMA multiply-adds.
+ *
+ * Over Modular<int64_t> or Modular<uint64_t> with a modulus below 2^52, the
+ * products can not be delayed in 64 bits, and the classic fgemm reduces each
+ * of them. With vpmadd52luq/vpmadd52huq, the low and high 52 bits of the
+ * products are instead accumulated in two 64-bit matrices by igemm52, over
+ * k-blocks of depth igemm52_kmax, and each block is reduced once.
+ * The two matrices only cover a panel of rows of C fitting in the share of
+ * the last level cache, and are taken from the Workspace of the helper.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_ifma_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_ifma_INL
+
+#include <givaro/modular.h>
+
+#include "fflas-ffpack/utils/fflas_tuning.h"
+#include "fflas-ffpack/utils/fflas_workspace.h"
+
+namespace FFLAS { namespace Protected {
+
+    /** Fields whose classic fgemm can be run by igemm52: elements stored as
+     * non negative 64-bit integers.
+     */
+    template<class Field>
+    struct IfmaFgemmSupport : public std::false_type {};
+    template<class Compute>
+    struct IfmaFgemmSupport<Givaro::Modular<int64_t, Compute> > : public std::true_type {};
+    template<class Compute>
+    struct IfmaFgemmSupport<Givaro::Modular<uint64_t, Compute> > : public std::true_type {};
+
+    /** \brief C <- alpha.op(A)*op(B) + beta.C with the 52-bit multiply-adds.
+     *
+     * A, B and C are reduced. Returns false without touching C if the modulus
+     * does not fit in 52 bits. The temporaries are taken from W if not null.
+     */
+    template<class Field>
+    inline bool fgemm_ifma (const Field& F,
+                            const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                            const size_t m, const size_t n, const size_t k,
+                            const typename Field::Element alpha,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb,
+                            const typename Field::Element beta,
+                            typename Field::Element_ptr C, const size_t ldc,
+                            Workspace* W, std::true_type)
+    {
+        typedef typename Field::Element Element;
+        const uint64_t p = (uint64_t) F.characteristic();
+        if (p > (UINT64_C(1) << 52))
+            return false;
+
+        fscalin (F, m, n, beta, C, ldc);
+        if (!k || F.isZero (alpha) || !m || !n)
+            return true;
+
+        // panels of mt rows of C, whose two halves fit in the share of the last level cache
+        const size_t mt = std::min (m, std::max (size_t(1), tuning().LLCShare() / (4*n*sizeof(uint64_t))));
+        uint64_t* Lo = workspace_new<uint64_t> (mt*n, Alignment::CACHE_LINE, W);
+        uint64_t* Hi = workspace_new<uint64_t> (mt*n, Alignment::CACHE_LINE, W);
+        const uint64_t* Au = reinterpret_cast<const uint64_t*> (A);
+        const uint64_t* Bu = reinterpret_cast<const uint64_t*> (B);
+        for (size_t i0 = 0; i0 < m; i0 += mt) {
+            const size_t mb = std::min (mt, m-i0);
+            const uint64_t* Ai = Au + ((ta == FflasNoTrans) ? i0*lda : i0);
+            Element* Ci = C + i0*ldc;
+            for (size_t k2 = 0; k2 < k; k2 += igemm52_kmax) {
+                const size_t kc = std::min (igemm52_kmax, k-k2);
+                const size_t shiftA = (ta == FflasNoTrans) ? k2 : k2*lda;
+                const size_t shiftB = (tb == FflasNoTrans) ? k2*ldb : k2;
+                std::fill (Lo, Lo+mb*n, UINT64_C(0));
+                std::fill (Hi, Hi+mb*n, UINT64_C(0));
+                // C is row major: its transpose is computed in column major, as in igemm_
+                igemm52 (tb, ta, n, mb, kc, Bu+shiftB, ldb, Ai+shiftA, lda, Lo, Hi, n, W);
+                for (size_t i = 0; i < mb; ++i)
+                    for (size_t j = 0; j < n; ++j) {
+                        const uint128_t x = ((uint128_t)Hi[i*n+j] << 52) + Lo[i*n+j];
+                        F.axpyin (Ci[i*ldc+j], alpha, (Element)(uint64_t)(x % p));
+                    }
+            }
+        }
+        workspace_delete (W, Hi, Lo);
+        return true;
+    }
+
+    template<class Field>
+    inline bool fgemm_ifma (const Field& F,
+                            const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                            const size_t m, const size_t n, const size_t k,
+                            const typename Field::Element alpha,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb,
+                            const typename Field::Element beta,
+                            typename Field::Element_ptr C, const size_t ldc,
+                            Workspace*, std::false_type)
+    {
+        return false;
+    }
+
+} // Protected
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_ifma_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
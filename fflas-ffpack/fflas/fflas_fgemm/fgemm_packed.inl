@@ -0,0 +1,485 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * the packing scheme follows the GotoBLAS/BLIS layered approach
+ * (see also fflas_igemm, adapted from the Eigen library)
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas_fgemm/fgemm_packed.inl
+ * @brief Native packed fgemm over floating point modular fields.
+ *
+ * The operands are packed into micro-panels and multiplied by a register
+ * blocked micro-kernel written with fflas_simd.h. The depth of each k-block
+ * is bounded by the delayed reduction bound of the MMHelper, so that the
+ * modular reduction of the C tile can be performed while it is still in
+ * registers, instead of running a separate freduce sweep over C after each
+ * BLAS call.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_packed_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_packed_INL
+
+#include <givaro/modular.h>
+#include <givaro/modular-balanced.h>
+
+#include "fflas-ffpack/fflas/fflas_simd.h"
+#include "fflas-ffpack/utils/fflas_memory.h"
+#include "fflas-ffpack/utils/fflas_tuning.h"
+
+// mr*2 accumulators + 2 B vectors + 1 broadcast must fit in the simd registers
+#ifdef __FFLASFFPACK_HAVE_AVX512F_INSTRUCTIONS
+#define __FFLASFFPACK_PACKED_MR 8
+#else
+#define __FFLASFFPACK_PACKED_MR 6
+#endif
+
+namespace FFLAS { namespace details { /*  packed fgemm */
+
+    /** Micro-kernel dimensions: MR rows of A by NR=2 simd vectors of B.
+    */
+    template<class T>
+    struct PackedKernelDim {
+        typedef Simd<T> simd;
+        static const constexpr size_t mr = __FFLASFFPACK_PACKED_MR;
+        static const constexpr size_t nr = 2*simd::vect_size;
+    };
+
+    /** \brief Computes the mc, nc, kc blocking dimensions of the packed fgemm.
+     * kc*nr elements fill half of L1, mc*kc half of L2 and kc*nc half of the last level.
+     */
+    template<class T>
+    inline void PackedBlockingFactor (size_t& mc, size_t& nc, size_t& kc)
+    {
+        tuning().blocking<T> (PackedKernelDim<T>::mr, PackedKernelDim<T>::nr, mc, nc, kc);
+    }
+
+    /** Packs the rows x cols block of op(A) into micro-panels of mr rows,
+     * each stored column by column (mr contiguous values per column), zero padded.
+     */
+    template<size_t mr, class T>
+    inline void pack_lhs_packed (T* blockA, const T* A, const size_t lda, const FFLAS_TRANSPOSE ta,
+                                 const size_t rows, const size_t cols)
+    {
+        for (size_t i = 0; i < rows; i += mr) {
+            const size_t r = std::min (mr, rows-i);
+            if (ta == FflasNoTrans) {
+                const T* Ai = A + i*lda;
+                for (size_t l = 0; l < cols; ++l) {
+                    size_t ii = 0;
+                    for (; ii < r; ++ii)
+                        *blockA++ = Ai[ii*lda+l];
+                    for (; ii < mr; ++ii)
+                        *blockA++ = T(0);
+                }
+            }
+            else {
+                const T* Ai = A + i;
+                for (size_t l = 0; l < cols; ++l) {
+                    size_t ii = 0;
+                    for (; ii < r; ++ii)
+                        *blockA++ = Ai[l*lda+ii];
+                    for (; ii < mr; ++ii)
+                        *blockA++ = T(0);
+                }
+            }
+        }
+    }
+
+    /** Packs the rows x cols block of op(B) into micro-panels of nr columns,
+     * each stored row by row (nr contiguous values per row), zero padded.
+     */
+    template<size_t nr, class T>
+    inline void pack_rhs_packed (T* blockB, const T* B, const size_t ldb, const FFLAS_TRANSPOSE tb,
+                                 const size_t rows, const size_t cols)
+    {
+        for (size_t j = 0; j < cols; j += nr) {
+            const size_t c = std::min (nr, cols-j);
+            if (tb == FflasNoTrans) {
+                const T* Bj = B + j;
+                for (size_t l = 0; l < rows; ++l) {
+                    size_t jj = 0;
+                    for (; jj < c; ++jj)
+                        *blockB++ = Bj[l*ldb+jj];
+                    for (; jj < nr; ++jj)
+                        *blockB++ = T(0);
+                }
+            }
+            else {
+                const T* Bj = B + j*ldb;
+                for (size_t l = 0; l < rows; ++l) {
+                    size_t jj = 0;
+                    for (; jj < c; ++jj)
+                        *blockB++ = Bj[jj*ldb+l];
+                    for (; jj < nr; ++jj)
+                        *blockB++ = T(0);
+                }
+            }
+        }
+    }
+
+    /** Parameters of the reduction fused in the micro-kernel.
+     * The kernel computes C <- s.A*B + beta.C on the first k-block, C <- C + s.A*B
+     * on the following ones, reduces the tile modulo p, and scales it by alpha
+     * on the last k-block, s being -1 if negate, 1 otherwise.
+     */
+    template<class T>
+    struct PackedReduction {
+        typedef Simd<T> simd;
+        typedef typename simd::vect_t vect_t;
+
+        vect_t P, INVP, NEGP, MIN, MAX, ALPHA, BETA;
+        bool negate, loadC, scal;
+
+        template<class Field>
+        PackedReduction (const Field& F, const T alpha, const T beta, const bool neg, const bool sc) :
+            negate(neg), loadC(beta != T(0)), scal(sc)
+        {
+            T p = (T) F.characteristic();
+            P = simd::set1(p);
+            INVP = simd::set1(T(1)/p);
+            NEGP = simd::set1(-p);
+            MIN = simd::set1((T) F.minElement());
+            MAX = simd::set1((T) F.maxElement());
+            ALPHA = simd::set1(alpha);
+            BETA = simd::set1(beta);
+        }
+
+        inline void update (vect_t& X, T* c, const bool first, const bool last) const
+        {
+            vect_t Q, R;
+            if (first) {
+                if (loadC) {
+                    R = simd::loadu(c);
+                    X = negate ? simd::fmsub(X, R, BETA) : simd::fmadd(X, R, BETA);
+                }
+                else if (negate)
+                    X = simd::sub(simd::zero(), X);
+            }
+            else {
+                R = simd::loadu(c);
+                X = negate ? simd::sub(R, X) : simd::add(R, X);
+            }
+            simd::mod(X, P, INVP, NEGP, MIN, MAX, Q, R);
+            if (last && scal) {
+                X = simd::mul(X, ALPHA);
+                simd::mod(X, P, INVP, NEGP, MIN, MAX, Q, R);
+            }
+            simd::storeu(c, X);
+        }
+    };
+
+    /** Micro-kernel: multiplies a packed mr x kc panel of A by a packed kc x nr
+     * panel of B and merges the result in the mr x nr tile of C, reduced.
+     */
+    template<class T>
+    inline void fgebp_packed (const size_t kc, const T* blA, const T* blB,
+                              T* C, const size_t ldc,
+                              const PackedReduction<T>& Red, const bool first, const bool last)
+    {
+        typedef Simd<T> simd;
+        typedef typename simd::vect_t vect_t;
+        const constexpr size_t mr = PackedKernelDim<T>::mr;
+        const constexpr size_t vs = simd::vect_size;
+
+        vect_t C0[mr], C1[mr];
+        for (size_t r = 0; r < mr; ++r)
+            C0[r] = C1[r] = simd::zero();
+
+        for (size_t l = 0; l < kc; ++l) {
+            const vect_t B0 = simd::load (blB);
+            const vect_t B1 = simd::load (blB+vs);
+            for (size_t r = 0; r < mr; ++r) {
+                const vect_t Ar = simd::set1 (blA[r]);
+                C0[r] = simd::fmadd (C0[r], Ar, B0);
+                C1[r] = simd::fmadd (C1[r], Ar, B1);
+            }
+            blA += mr;
+            blB += 2*vs;
+        }
+
+        for (size_t r = 0; r < mr; ++r) {
+            Red.update (C0[r], C+r*ldc, first, last);
+            Red.update (C1[r], C+r*ldc+vs, first, last);
+        }
+    }
+
+    /** Applies the micro-kernel on a possibly partial tile of C of dimension r x c.
+    */
+    template<class T>
+    inline void fgebp_packed_edge (const size_t kc, const T* blA, const T* blB,
+                                   T* C, const size_t ldc, const size_t r, const size_t c,
+                                   const PackedReduction<T>& Red, const bool first, const bool last)
+    {
+        const constexpr size_t mr = PackedKernelDim<T>::mr;
+        const constexpr size_t nr = PackedKernelDim<T>::nr;
+        if (r == mr && c == nr) {
+            fgebp_packed (kc, blA, blB, C, ldc, Red, first, last);
+            return;
+        }
+        T tile[mr*nr] = {};
+        if (!first || Red.loadC)
+            for (size_t i = 0; i < r; ++i)
+                for (size_t j = 0; j < c; ++j)
+                    tile[i*nr+j] = C[i*ldc+j];
+        fgebp_packed (kc, blA, blB, tile, nr, Red, first, last);
+        for (size_t i = 0; i < r; ++i)
+            for (size_t j = 0; j < c; ++j)
+                C[i*ldc+j] = tile[i*nr+j];
+    }
+
+    /** Packs the whole rows x cols matrix op(A) by k-blocks of depth kc: the block
+     * of columns pc..pc+kc-1 is packed by pack_lhs_packed at offset pc*rows,
+     * rows being rounded up to a multiple of mr.
+     */
+    template<size_t mr, class T>
+    inline void pack_lhs_full (T* blockA, const T* A, const size_t lda, const FFLAS_TRANSPOSE ta,
+                               const size_t rows, const size_t cols, const size_t kc)
+    {
+        const size_t rpad = ((rows+mr-1)/mr)*mr;
+        for (size_t pc = 0; pc < cols; pc += kc)
+            pack_lhs_packed<mr> (blockA+pc*rpad, (ta == FflasNoTrans) ? A+pc : A+pc*lda, lda, ta,
+                                 rows, std::min (kc, cols-pc));
+    }
+
+    /** Packs the whole rows x cols matrix op(B) by k-blocks of depth kc: the block
+     * of rows pc..pc+kc-1 is packed by pack_rhs_packed at offset pc*cols,
+     * cols being rounded up to a multiple of nr.
+     */
+    template<size_t nr, class T>
+    inline void pack_rhs_full (T* blockB, const T* B, const size_t ldb, const FFLAS_TRANSPOSE tb,
+                               const size_t rows, const size_t cols, const size_t kc)
+    {
+        const size_t cpad = ((cols+nr-1)/nr)*nr;
+        for (size_t pc = 0; pc < rows; pc += kc)
+            pack_rhs_packed<nr> (blockB+pc*cpad, (tb == FflasNoTrans) ? B+pc*ldb : B+pc, ldb, tb,
+                                 std::min (kc, rows-pc), cols);
+    }
+
+    /** Blocking of a packed fgemm of dimensions m x n x k, where the first
+     * k-block is at most kmaxfirst deep and the following ones kmax deep.
+     */
+    template<class T>
+    struct PackedBlocking {
+        size_t mc, nc, kc0, kc1;
+        size_t sizeA, sizeB; //!< number of elements of the packed blocks of A and B
+
+        PackedBlocking (const size_t m, const size_t n, const size_t k,
+                        const size_t kmaxfirst, const size_t kmax)
+        {
+            const constexpr size_t mr = PackedKernelDim<T>::mr;
+            const constexpr size_t nr = PackedKernelDim<T>::nr;
+            size_t kc;
+            PackedBlockingFactor<T> (mc, nc, kc);
+            kc0 = std::min (kc, kmaxfirst);
+            kc1 = std::min (kc, kmax);
+            const size_t kcm = std::min (k, std::max (kc0, kc1));
+            // whole micro-panels, so that prepacked operands can be addressed by block
+            mc = std::min (std::max (mr, (mc/mr)*mr), ((m+mr-1)/mr)*mr);
+            nc = std::min (std::max (nr, (nc/nr)*nr), ((n+nr-1)/nr)*nr);
+            sizeA = mc*kcm;
+            sizeB = nc*kcm;
+        }
+    };
+
+    /** \brief C <- alpha.(s.op(A)*op(B) + beta.C) mod p, with reduced output.
+     *
+     * \param kmaxfirst maximal depth of the first k-block (accumulating beta.C)
+     * \param kmax maximal depth of the following k-blocks (accumulating a reduced C)
+     * \param blockA, blockB simd aligned workspaces of Blk.sizeA and Blk.sizeB elements
+     * \param preA, preB if not null, op(A) (resp. op(B)) already packed by k-blocks of
+     * depth Blk.kc0 == Blk.kc1, as done by pack_lhs_full (resp. pack_rhs_full).
+     * The corresponding workspace is then not used.
+     */
+    template<class Field>
+    inline void fgemm_packed (const Field& F,
+                              const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                              const size_t m, const size_t n, const size_t k,
+                              const typename Field::Element* A, const size_t lda,
+                              const typename Field::Element* B, const size_t ldb,
+                              typename Field::Element* C, const size_t ldc,
+                              const PackedReduction<typename Field::Element>& Red,
+                              const PackedBlocking<typename Field::Element>& Blk,
+                              typename Field::Element* blockA, typename Field::Element* blockB,
+                              const typename Field::Element* preA = nullptr,
+                              const typename Field::Element* preB = nullptr)
+    {
+        typedef typename Field::Element T;
+        const constexpr size_t mr = PackedKernelDim<T>::mr;
+        const constexpr size_t nr = PackedKernelDim<T>::nr;
+        const size_t mc = Blk.mc, nc = Blk.nc;
+        const size_t mpad = ((m+mr-1)/mr)*mr;
+        const size_t npad = ((n+nr-1)/nr)*nr;
+        FFLASFFPACK_check((!preA && !preB) || Blk.kc0 == Blk.kc1);
+
+        for (size_t jc = 0; jc < n; jc += nc) {
+            const size_t ncb = std::min (nc, n-jc);
+            size_t kcb;
+            for (size_t pc = 0; pc < k; pc += kcb) {
+                kcb = std::min ((pc ? Blk.kc1 : Blk.kc0), k-pc);
+                const bool first = (pc == 0);
+                const bool last = (pc+kcb == k);
+                const T* blB = blockB;
+                if (preB)
+                    blB = preB + pc*npad + jc*kcb;
+                else
+                    pack_rhs_packed<nr> (blockB, (tb == FflasNoTrans) ? B+pc*ldb+jc : B+jc*ldb+pc, ldb, tb, kcb, ncb);
+
+                for (size_t ic = 0; ic < m; ic += mc) {
+                    const size_t mcb = std::min (mc, m-ic);
+                    const T* blA = blockA;
+                    if (preA)
+                        blA = preA + pc*mpad + ic*kcb;
+                    else
+                        pack_lhs_packed<mr> (blockA, (ta == FflasNoTrans) ? A+ic*lda+pc : A+pc*lda+ic, lda, ta, mcb, kcb);
+
+                    for (size_t jr = 0; jr < ncb; jr += nr)
+                        for (size_t ir = 0; ir < mcb; ir += mr)
+                            fgebp_packed_edge (kcb, blA+ir*kcb, blB+jr*kcb,
+                                               C+(ic+ir)*ldc+jc+jr, ldc,
+                                               std::min (mr, mcb-ir), std::min (nr, ncb-jr),
+                                               Red, first, last);
+                }
+            }
+        }
+    }
+
+    template<class Field>
+    inline void fgemm_packed (const Field& F,
+                              const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                              const size_t m, const size_t n, const size_t k,
+                              const typename Field::Element* A, const size_t lda,
+                              const typename Field::Element* B, const size_t ldb,
+                              typename Field::Element* C, const size_t ldc,
+                              const PackedReduction<typename Field::Element>& Red,
+                              const size_t kmaxfirst, const size_t kmax, Workspace* W = nullptr)
+    {
+        typedef typename Field::Element T;
+        typedef Simd<T> simd;
+        FFLASFFPACK_check(kmaxfirst && kmax);
+
+        PackedBlocking<T> Blk (m, n, k, kmaxfirst, kmax);
+        T* blockA = workspace_new<T> (Blk.sizeA, (Alignment)simd::alignment, W);
+        T* blockB = workspace_new<T> (Blk.sizeB, (Alignment)simd::alignment, W);
+        fgemm_packed (F, ta, tb, m, n, k, A, lda, B, ldb, C, ldc, Red, Blk, blockA, blockB);
+        workspace_delete (W, blockB, blockA);
+    }
+
+} // details
+} // FFLAS
+
+namespace FFLAS { namespace Protected {
+
+    /** Fields whose fgemm can be run by the native packed kernel.
+    */
+    template<class Field>
+    struct PackedFgemmSupport : public std::false_type {};
+    template<>
+    struct PackedFgemmSupport<Givaro::Modular<double> > : public std::true_type {};
+    template<>
+    struct PackedFgemmSupport<Givaro::Modular<float> > : public std::true_type {};
+    template<>
+    struct PackedFgemmSupport<Givaro::ModularBalanced<double> > : public std::true_type {};
+    template<>
+    struct PackedFgemmSupport<Givaro::ModularBalanced<float> > : public std::true_type {};
+
+    /** \brief Scalars of the packed kernel computing alpha.(A*B + beta.C) as alpha.(alphadf.A*B + betadf.C),
+     * with alphadf = +/-1, as in the lazy classic fgemm.
+     */
+    template<class Field, class HelperType>
+    inline void packed_scalars (const Field& F, const HelperType& H,
+                                const typename Field::Element alpha, const typename Field::Element beta,
+                                typename HelperType::DFElt& alphadf, typename HelperType::DFElt& betadf)
+    {
+        betadf = beta;
+        if (F.isMOne (alpha)) {
+            alphadf = -H.delayedField.one;
+        } else {
+            alphadf = F.one;
+            if (! F.isOne (alpha)) {
+                typename Field::Element betadalpha;
+                F.init (betadalpha);
+                F.div (betadalpha, beta, alpha);
+                betadf = betadalpha;
+            }
+        }
+        if (F.isMOne (betadf)) betadf = -F.one;
+    }
+
+    /** \brief Runs the lazy classic fgemm with the packed kernel when it saves reduction sweeps.
+     *
+     * Computes C <- alpha.(alphadf.A*B + betadf.C) reduced in the field,
+     * and returns false without touching C if the packed kernel does not apply.
+     */
+    template<class Field, class HelperType>
+    inline bool fgemm_packed (const Field& F,
+                              const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                              const size_t m, const size_t n, const size_t k,
+                              const typename Field::Element alpha,
+                              const typename HelperType::DFElt alphadf,
+                              const typename HelperType::DFElt betadf,
+                              typename Field::ConstElement_ptr A, const size_t lda,
+                              typename Field::ConstElement_ptr B, const size_t ldb,
+                              typename Field::Element_ptr C, const size_t ldc,
+                              const size_t kmaxfirst, HelperType& H, std::true_type)
+    {
+        typedef typename Field::Element T;
+        // Number of intermediate freduce sweeps the BLAS path would require
+        if ((k-1) / kmaxfirst < __FFLASFFPACK_PACKED_FGEMM_KBLOCKS)
+            return false;
+
+        HelperType Hc (H);
+        Hc.initC();
+        const size_t kmax = Hc.MaxDelayedDim (typename HelperType::DFElt(1));
+        if (!kmax)
+            return false;
+
+        const bool scal = !F.isOne(alpha) && !F.isMOne(alpha);
+        T al; F.convert (al, alpha);
+        details::PackedReduction<T> Red (F, al, (T)betadf, alphadf < 0, scal);
+        details::fgemm_packed (F, ta, tb, m, n, k, A, lda, B, ldb, C, ldc, Red, kmaxfirst, kmax, H.WS);
+        H.initOut();
+        return true;
+    }
+
+    template<class Field, class HelperType>
+    inline bool fgemm_packed (const Field& F,
+                              const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                              const size_t m, const size_t n, const size_t k,
+                              const typename Field::Element alpha,
+                              const typename HelperType::DFElt alphadf,
+                              const typename HelperType::DFElt betadf,
+                              typename Field::ConstElement_ptr A, const size_t lda,
+                              typename Field::ConstElement_ptr B, const size_t ldb,
+                              typename Field::Element_ptr C, const size_t ldc,
+                              const size_t kmaxfirst, HelperType& H, std::false_type)
+    {
+        return false;
+    }
+
+} // Protected
+} // FFLAS
+
+#undef __FFLASFFPACK_PACKED_MR
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_packed_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_fgemm/fgemm_prepared.inl
+ * @brief fgemm with one operand reduced and packed once for many products.
+ *
+ * In iterative methods (Krylov, block Wiedemann) the same matrix is
+ * multiplied by many others. A PreparedMatrix performs the reduction of
+ * this operand, and over the fields of the packed kernel its packing into
+ * micro-panels, once at construction; the fgemm overloads taking it only
+ * pack the other operand.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_prepared_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_prepared_INL
+
+namespace FFLAS {
+
+    /** \brief Operand of fgemm prepared once for repeated products.
+     *
+     * Holds the rows x cols matrix op(M), reduced in the field. It is the left
+     * operand A of the products if \p side is FflasLeft, the right operand B
+     * otherwise. Over the fields supported by the packed kernel, op(M) is
+     * stored packed by k-blocks of depth kc(), the depth being chosen small
+     * enough for any alpha and beta; otherwise a reduced copy of M is kept,
+     * and kc() is 0.
+     */
+    template<class Field>
+    class PreparedMatrix {
+    public:
+        typedef typename Field::Element Element;
+        typedef typename Field::Element_ptr Element_ptr;
+        typedef typename Field::ConstElement_ptr ConstElement_ptr;
+
+        PreparedMatrix (const Field& F, const FFLAS_SIDE side, const FFLAS_TRANSPOSE trans,
+                        const size_t rows, const size_t cols, ConstElement_ptr M, const size_t ldm) :
+            _side(side), _trans(trans), _rows(rows), _cols(cols), _ld(0), _kc(0), _data(nullptr)
+        {
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+            prepare (F, M, ldm, typename Protected::PackedFgemmSupport<Field>::type());
+#else
+            prepare (F, M, ldm, std::false_type());
+#endif
+        }
+
+        ~PreparedMatrix () { fflas_delete (_data); }
+
+        PreparedMatrix (const PreparedMatrix&) = delete;
+        PreparedMatrix& operator= (const PreparedMatrix&) = delete;
+
+        FFLAS_SIDE side () const { return _side; }
+        size_t rowdim () const { return _rows; }
+        size_t coldim () const { return _cols; }
+
+        //! depth of the k-blocks of the packed storage, 0 if not packed
+        size_t kc () const { return _kc; }
+        //! transposition and stride of the reduced copy, when not packed
+        FFLAS_TRANSPOSE trans () const { return _trans; }
+        size_t ld () const { return _ld; }
+        ConstElement_ptr data () const { return _data; }
+
+    private:
+        FFLAS_SIDE _side;
+        FFLAS_TRANSPOSE _trans;
+        size_t _rows, _cols, _ld, _kc;
+        Element_ptr _data;
+
+        void prepare (const Field& F, ConstElement_ptr M, const size_t ldm, std::false_type)
+        {
+            const size_t r = (_trans == FflasNoTrans) ? _rows : _cols;
+            const size_t c = (_trans == FflasNoTrans) ? _cols : _rows;
+            _ld = c;
+            _data = fflas_new (F, r, c);
+            freduce (F, r, c, M, ldm, _data, _ld);
+        }
+
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        void prepare (const Field& F, ConstElement_ptr M, const size_t ldm, std::true_type)
+        {
+            typedef MMHelper<Field, MMHelperAlgo::Classic, ModeCategories::LazyTag> HelperType;
+            typedef typename HelperType::DFElt DFElt;
+            typedef Simd<Element> simd;
+            const constexpr size_t mr = details::PackedKernelDim<Element>::mr;
+            const constexpr size_t nr = details::PackedKernelDim<Element>::nr;
+
+            // The first k-block accumulates betadf.C, for an unknown betadf in the field
+            HelperType H (F, 0);
+            const size_t kmax = std::min (H.MaxDelayedDim (std::max (-H.FieldMin, H.FieldMax)),
+                                          H.MaxDelayedDim (DFElt(1)));
+            if (!kmax)
+                return prepare (F, M, ldm, std::false_type());
+
+            if (_side == FflasLeft) {
+                details::PackedBlocking<Element> Blk (_rows, 0, _cols, kmax, kmax);
+                const size_t size = ((_rows+mr-1)/mr)*mr*_cols;
+                _kc = Blk.kc0;
+                _data = fflas_new<Element> (size, (Alignment)simd::alignment);
+                details::pack_lhs_full<mr> (_data, M, ldm, _trans, _rows, _cols, _kc);
+                freduce (F, size, _data, 1);
+            }
+            else {
+                details::PackedBlocking<Element> Blk (0, _cols, _rows, kmax, kmax);
+                const size_t size = _rows*((_cols+nr-1)/nr)*nr;
+                _kc = Blk.kc0;
+                _data = fflas_new<Element> (size, (Alignment)simd::alignment);
+                details::pack_rhs_full<nr> (_data, M, ldm, _trans, _rows, _cols, _kc);
+                freduce (F, size, _data, 1);
+            }
+        }
+#endif
+    };
+
+} // FFLAS
+
+namespace FFLAS { namespace Protected {
+
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+    /** \brief C <- alpha.op(A)*op(B) + beta.C with the packed kernel, where A
+     * (resp. B) is taken from preA (resp. preB) if not null, packed by k-blocks of depth kc.
+     */
+    template<class Field>
+    inline typename Field::Element_ptr
+    fgemm_prepared (const Field& F,
+                    const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                    const size_t m, const size_t n, const size_t k,
+                    const typename Field::Element alpha,
+                    typename Field::ConstElement_ptr A, const size_t lda,
+                    typename Field::ConstElement_ptr B, const size_t ldb,
+                    const typename Field::Element beta,
+                    typename Field::Element_ptr C, const size_t ldc,
+                    const size_t kc,
+                    typename Field::ConstElement_ptr preA, typename Field::ConstElement_ptr preB)
+    {
+        typedef MMHelper<Field, MMHelperAlgo::Classic, ModeCategories::LazyTag> HelperType;
+        typedef typename HelperType::DFElt DFElt;
+        typedef typename Field::Element T;
+        typedef Simd<T> simd;
+
+        if (!k || F.isZero (alpha)){
+            fscalin (F, m, n, beta, C, ldc);
+            return C;
+        }
+
+        HelperType H (F, 0);
+        DFElt alphadf, betadf;
+        packed_scalars (F, H, alpha, beta, alphadf, betadf);
+
+        const bool scal = !F.isOne (alpha) && !F.isMOne (alpha);
+        T al; F.convert (al, alpha);
+        details::PackedReduction<T> Red (F, al, (T)betadf, alphadf < 0, scal);
+        details::PackedBlocking<T> Blk (m, n, k, kc, kc);
+        T* blockA = preA ? nullptr : fflas_new<T> (Blk.sizeA, (Alignment)simd::alignment);
+        T* blockB = preB ? nullptr : fflas_new<T> (Blk.sizeB, (Alignment)simd::alignment);
+        details::fgemm_packed (F, ta, tb, m, n, k, A, lda, B, ldb, C, ldc, Red, Blk, blockA, blockB, preA, preB);
+        if (blockA) fflas_delete (blockA);
+        if (blockB) fflas_delete (blockB);
+        return C;
+    }
+#endif
+
+} // Protected
+} // FFLAS
+
+namespace FFLAS {
+
+    template<class Field>
+    inline typename Field::Element_ptr
+    fgemm (const Field& F,
+           const FFLAS_TRANSPOSE tb,
+           const size_t n,
+           const typename Field::Element alpha,
+           const PreparedMatrix<Field>& A,
+           typename Field::ConstElement_ptr B, const size_t ldb,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc)
+    {
+        FFLASFFPACK_check(A.side() == FflasLeft);
+        const size_t m = A.rowdim(), k = A.coldim();
+        if (!m || !n) return C;
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        if (A.kc())
+            return Protected::fgemm_prepared (F, FflasNoTrans, tb, m, n, k, alpha, nullptr, 0, B, ldb,
+                                              beta, C, ldc, A.kc(), A.data(), nullptr);
+#endif
+        return fgemm (F, A.trans(), tb, m, n, k, alpha, A.data(), A.ld(), B, ldb, beta, C, ldc);
+    }
+
+    template<class Field>
+    inline typename Field::Element_ptr
+    fgemm (const Field& F,
+           const FFLAS_TRANSPOSE ta,
+           const size_t m,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           const PreparedMatrix<Field>& B,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc)
+    {
+        FFLASFFPACK_check(B.side() == FflasRight);
+        const size_t k = B.rowdim(), n = B.coldim();
+        if (!m || !n) return C;
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        if (B.kc())
+            return Protected::fgemm_prepared (F, ta, FflasNoTrans, m, n, k, alpha, A, lda, nullptr, 0,
+                                              beta, C, ldc, B.kc(), nullptr, B.data());
+#endif
+        return fgemm (F, ta, B.trans(), m, n, k, alpha, A, lda, B.data(), B.ld(), beta, C, ldc);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_prepared_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
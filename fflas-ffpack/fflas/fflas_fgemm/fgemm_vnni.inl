@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas_fgemm/fgemm_vnni.inl
+ * @brief fgemm over 8 and 16-bit fields with the VNNI 16-bit dot products.
+ *
+ * Over Modular<int8_t> and Modular<int16_t> (and their unsigned variants),
+ * fgemm converts the operands to float or double for BLAS. When vpdpwssd is
+ * available, the operands are instead packed as pairs of 16-bit integers
+ * along k and multiplied by a register blocked kernel accumulating in 32-bit
+ * lanes: sixteen products per instruction on a 256-bit register, on operands
+ * two to four times smaller. The 32-bit tiles are flushed to a 64-bit matrix
+ * after each k-block, within the delayed reduction bound of 32-bit integers,
+ * and this matrix is reduced once at the end.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_vnni_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_vnni_INL
+
+#include <givaro/modular.h>
+
+#include "fflas-ffpack/fflas/fflas_simd.h"
+#include "fflas-ffpack/utils/fflas_memory.h"
+
+// 2*MR accumulators + 2 B vectors + 1 broadcast within the 16 ymm registers
+#define __FFLASFFPACK_VNNI_MR 6
+// depth of the k-blocks, in pairs, for the packed panels to stay in cache
+#define __FFLASFFPACK_VNNI_KC 256
+
+namespace FFLAS { namespace details { /*  vnni fgemm */
+
+    /** \brief Tile of MR rows of A by 16 columns of B, over kp pairs along k.
+     *
+     * pa holds, for each pair, MR 32-bit words with the 2 entries of a row;
+     * pb holds, for each pair, 16 columns of 2 interleaved entries.
+     */
+    inline void vnni_kernel (const size_t kp, const int32_t* pa, const int16_t* pb, int32_t* tile)
+    {
+        using simd = Simd256<int16_t>;
+        using simd32 = Simd256<int32_t>;
+        using vect_t = typename simd::vect_t;
+        const constexpr size_t mr = __FFLASFFPACK_VNNI_MR;
+        vect_t C0[mr], C1[mr], B0, B1, A;
+        for (size_t i = 0; i < mr; ++i)
+            C0[i] = C1[i] = simd32::zero();
+        for (size_t q = 0; q < kp; ++q, pa += mr, pb += 32) {
+            B0 = simd::load (pb);
+            B1 = simd::load (pb + 16);
+            for (size_t i = 0; i < mr; ++i) {
+                A = simd32::set1 (pa[i]);
+                simd::dpwssdin (C0[i], A, B0);
+                simd::dpwssdin (C1[i], A, B1);
+            }
+        }
+        for (size_t i = 0; i < mr; ++i) {
+            simd32::store (tile + 16*i, C0[i]);
+            simd32::store (tile + 16*i + 8, C1[i]);
+        }
+    }
+
+    /** Packs the rows x depth block op(A) by groups of MR rows and pairs along k,
+     * padding with zeros.
+     */
+    template<class Element>
+    inline void vnni_pack_lhs (int16_t* XX, const Element* X, const size_t ldx, const FFLAS_TRANSPOSE trans,
+                               const size_t rows, const size_t depth)
+    {
+        const constexpr size_t mr = __FFLASFFPACK_VNNI_MR;
+        const size_t kp = (depth+1)/2;
+        for (size_t i0 = 0; i0 < rows; i0 += mr)
+            for (size_t q = 0; q < kp; ++q)
+                for (size_t i = i0; i < i0+mr; ++i)
+                    for (size_t l = 2*q; l < 2*q+2; ++l, ++XX)
+                        *XX = (i < rows && l < depth) ?
+                        (int16_t)((trans == FflasNoTrans) ? X[i*ldx+l] : X[l*ldx+i]) : 0;
+    }
+
+    /** Packs the depth x cols block op(B) by groups of 16 columns and pairs along k,
+     * padding with zeros.
+     */
+    template<class Element>
+    inline void vnni_pack_rhs (int16_t* XX, const Element* X, const size_t ldx, const FFLAS_TRANSPOSE trans,
+                               const size_t depth, const size_t cols)
+    {
+        const size_t kp = (depth+1)/2;
+        for (size_t j0 = 0; j0 < cols; j0 += 16)
+            for (size_t q = 0; q < kp; ++q)
+                for (size_t j = j0; j < j0+16; ++j)
+                    for (size_t l = 2*q; l < 2*q+2; ++l, ++XX)
+                        *XX = (j < cols && l < depth) ?
+                        (int16_t)((trans == FflasNoTrans) ? X[l*ldx+j] : X[j*ldx+l]) : 0;
+    }
+
+    /** \brief Acc += op(A)*op(B), with Acc an m x n row major matrix of 64-bit integers.
+     *
+     * The entries of A and B are non negative and below 2^15, and the
+     * products of kmax of them fit in an int32_t.
+     */
+    template<class Element>
+    inline void fgemm_vnni (const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                            const size_t m, const size_t n, const size_t k,
+                            const Element* A, const size_t lda, const Element* B, const size_t ldb,
+                            int64_t* Acc, const size_t kmax)
+    {
+        const constexpr size_t mr = __FFLASFFPACK_VNNI_MR;
+        const size_t kc = std::min (kmax & ~size_t(1), size_t(2*__FFLASFFPACK_VNNI_KC));
+        const size_t mc = std::min (((m+mr-1)/mr)*mr, size_t(20*mr));
+        const size_t np = (n+15)/16;
+        int16_t* blockA = fflas_new<int16_t> (mc*kc, Alignment::CACHE_LINE);
+        int16_t* blockB = fflas_new<int16_t> (np*16*kc, Alignment::CACHE_LINE);
+        int32_t* tile = fflas_new<int32_t> (mr*16, Alignment::CACHE_LINE);
+
+        for (size_t k0 = 0; k0 < k; k0 += kc) {
+            const size_t kb = std::min (kc, k-k0), kp = (kb+1)/2;
+            vnni_pack_rhs (blockB, (tb == FflasNoTrans) ? B+k0*ldb : B+k0, ldb, tb, kb, n);
+            for (size_t i0 = 0; i0 < m; i0 += mc) {
+                const size_t mb = std::min (mc, m-i0);
+                vnni_pack_lhs (blockA, (ta == FflasNoTrans) ? A+i0*lda+k0 : A+k0*lda+i0, lda, ta, mb, kb);
+                for (size_t j = 0; j < np; ++j)
+                    for (size_t i = 0; i < mb; i += mr) {
+                        vnni_kernel (kp, reinterpret_cast<const int32_t*>(blockA + i*2*kp),
+                                     blockB + j*32*kp, tile);
+                        const size_t ie = std::min (mr, mb-i), je = std::min (size_t(16), n-16*j);
+                        for (size_t ii = 0; ii < ie; ++ii)
+                            for (size_t jj = 0; jj < je; ++jj)
+                                Acc[(i0+i+ii)*n + 16*j+jj] += tile[16*ii+jj];
+                    }
+            }
+        }
+        fflas_delete (blockA, blockB, tile);
+    }
+
+} // details
+} // FFLAS
+
+namespace FFLAS { namespace Protected {
+
+    /** Fields whose fgemm can be run by the VNNI kernel: elements stored as
+     * non negative integers of at most 16 bits.
+     */
+    template<class Field>
+    struct VnniFgemmSupport : public std::false_type {};
+    template<class Compute>
+    struct VnniFgemmSupport<Givaro::Modular<int8_t, Compute> > : public std::true_type {};
+    template<class Compute>
+    struct VnniFgemmSupport<Givaro::Modular<uint8_t, Compute> > : public std::true_type {};
+    template<class Compute>
+    struct VnniFgemmSupport<Givaro::Modular<int16_t, Compute> > : public std::true_type {};
+    template<class Compute>
+    struct VnniFgemmSupport<Givaro::Modular<uint16_t, Compute> > : public std::true_type {};
+
+    /** \brief C <- alpha.op(A)*op(B) + beta.C with the VNNI kernel.
+     *
+     * Returns false without touching C if the modulus is too large for the
+     * 32-bit accumulators to hold enough products.
+     */
+    template<class Field>
+    inline bool fgemm_vnni (const Field& F,
+                            const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                            const size_t m, const size_t n, const size_t k,
+                            const typename Field::Element alpha,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb,
+                            const typename Field::Element beta,
+                            typename Field::Element_ptr C, const size_t ldc,
+                            std::true_type)
+    {
+        typedef typename Field::Element Element;
+        const uint64_t p = (uint64_t) F.characteristic();
+        if (p > (UINT64_C(1) << 15))
+            return false;
+        // the k-blocks must be deep enough for the flushes to the 64-bit matrix to be amortized
+        const size_t kmax = (size_t) (INT32_MAX / ((p-1)*(p-1)));
+        if (kmax < 64)
+            return false;
+
+        fscalin (F, m, n, beta, C, ldc);
+        if (!k || F.isZero (alpha))
+            return true;
+
+        int64_t* Acc = fflas_new<int64_t> (m*n, Alignment::CACHE_LINE);
+        std::fill (Acc, Acc+m*n, int64_t(0));
+        details::fgemm_vnni (ta, tb, m, n, k, A, lda, B, ldb, Acc, kmax);
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j)
+                F.axpyin (C[i*ldc+j], alpha, (Element)(Acc[i*n+j] % (int64_t)p));
+        fflas_delete (Acc);
+        return true;
+    }
+
+    template<class Field>
+    inline bool fgemm_vnni (const Field& F,
+                            const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                            const size_t m, const size_t n, const size_t k,
+                            const typename Field::Element alpha,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::ConstElement_ptr B, const size_t ldb,
+                            const typename Field::Element beta,
+                            typename Field::Element_ptr C, const size_t ldc,
+                            std::false_type)
+    {
+        return false;
+    }
+
+} // Protected
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_vnni_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
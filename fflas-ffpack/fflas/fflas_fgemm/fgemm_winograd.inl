@@ -52,6 +52,7 @@
 //#define OLDWINO
 
 #include "fflas-ffpack/fflas-ffpack-config.h"
+#include "fflas-ffpack/utils/fflas_tuning.h"
 
 
 // DynamicPeeling, WinogradCalc
@@ -62,13 +63,13 @@ namespace FFLAS { namespace Protected {
      * \param m the common dimension in the product AxB
      */
     template<class Field>
-    inline int WinogradThreshold(const Field& F) {return __FFLASFFPACK_WINOTHRESHOLD;}
+    inline int WinogradThreshold(const Field& F) {return (int)tuning().WinoThreshold;}
     template<>
-    inline int WinogradThreshold (const Givaro::Modular<float>& F) {return __FFLASFFPACK_WINOTHRESHOLD_FLT;}
+    inline int WinogradThreshold (const Givaro::Modular<float>& F) {return (int)tuning().WinoThresholdFlt;}
     template<>
-    inline int WinogradThreshold (const Givaro::ModularBalanced<double> & F) {return __FFLASFFPACK_WINOTHRESHOLD_BAL;}
+    inline int WinogradThreshold (const Givaro::ModularBalanced<double> & F) {return (int)tuning().WinoThresholdBal;}
     template<>
-    inline int WinogradThreshold (const Givaro::ModularBalanced<float> & F) {return __FFLASFFPACK_WINOTHRESHOLD_BAL_FLT;}
+    inline int WinogradThreshold (const Givaro::ModularBalanced<float> & F) {return (int)tuning().WinoThresholdBalFlt;}
 
     template<class Field>
     inline int WinogradSteps (const Field & F, const size_t & m)
@@ -362,6 +363,59 @@ namespace FFLAS { namespace Protected {
 
     } // WinogradCalc
 
+    /** \brief Switch between the schedules of a level of the parallel Strassen-Winograd multiplication.
+     *
+     * Multiplies the 2mr x 2kr core of A by the 2kr x 2nr core of B, using at
+     * most H.WorkspaceBudget bytes of temporaries:
+     *  - WinoPar, with the seven products as parallel tasks, if its 11 temporaries
+     *    (12 when beta is not zero, where it accumulates in C) fit in the budget.
+     *    Each product then chooses its own schedule with a seventh of the remaining budget;
+     *  - otherwise the sequential schedules of WinogradCalc, with 2 or 3 temporaries per level;
+     *  - otherwise a classic parallel fgemm, without any temporary.
+     * The in-place schedules are not candidates: they overwrite A and B.
+     */
+    template <class Field, class ModeT, class Cut, class Param>
+    inline void WinogradParCalc (const Field& F,
+                                 const FFLAS_TRANSPOSE ta,
+                                 const FFLAS_TRANSPOSE tb,
+                                 const size_t mr, const size_t nr, const size_t kr,
+                                 const typename Field::Element alpha,
+                                 typename Field::ConstElement_ptr A,const size_t lda,
+                                 typename Field::ConstElement_ptr B,const size_t ldb,
+                                 const typename Field::Element beta,
+                                 typename Field::Element_ptr C, const size_t ldc,
+                                 MMHelper<Field, MMHelperAlgo::WinogradPar, ModeT, ParSeqHelper::Parallel<Cut,Param> > & H)
+    {
+        typedef typename Field::Element Element;
+        const size_t nt = H.parseq.numthreads();
+        const size_t budget = H.WorkspaceBudget / sizeof(Element);
+        const bool acc = !F.isZero (beta);
+
+        if (nt > 1 && WinoParMemory (mr, nr, kr, acc) <= budget) {
+            BLAS3::WinoPar (F, ta, tb, mr, nr, kr, alpha, A, lda, B, ldb, beta, C, ldc, H);
+            return;
+        }
+
+        if (WinogradSeqMemory (mr, nr, kr, H.recLevel, acc) <= budget) {
+            // run by this task only, which can keep the arena
+            MMHelper<Field, MMHelperAlgo::Winograd, ModeT> HS (H);
+            HS.WS = H.WS;
+            WinogradCalc (F, ta, tb, mr, nr, kr, alpha, A, lda, B, ldb, beta, C, ldc, HS);
+            H.Outmin = HS.Outmin;
+            H.Outmax = HS.Outmax;
+            return;
+        }
+
+        // The delayed classic product returns a reduced C
+        typedef ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> PS_t;
+        MMHelper<Field, MMHelperAlgo::Winograd, ModeCategories::DelayedTag, PS_t> HC (F, 0, PS_t(nt));
+        HC.Amin = H.Amin; HC.Amax = H.Amax;
+        HC.Bmin = H.Bmin; HC.Bmax = H.Bmax;
+        HC.Cmin = H.Cmin; HC.Cmax = H.Cmax;
+        fgemm (F, ta, tb, 2*mr, 2*nr, 2*kr, alpha, A, lda, B, ldb, beta, C, ldc, HC);
+        H.initOut();
+    } // WinogradParCalc
+
 
 
 
@@ -523,7 +577,7 @@ namespace FFLAS{
         size_t n2 = (n >> ww) << (ww-1) ;
         size_t k2 = (k >> ww) << (ww-1) ;
 
-        BLAS3::WinoPar (F, ta, tb, m2, n2, k2, alpha, A, lda, B, ldb, beta, C, ldc, H);
+        Protected::WinogradParCalc (F, ta, tb, m2, n2, k2, alpha, A, lda, B, ldb, beta, C, ldc, H);
 
         size_t mr = m -2*m2;
         size_t nr = n -2*n2;
@@ -533,6 +587,7 @@ namespace FFLAS{
         FFLASFFPACK_check(n == n2*2+nr);
         FFLASFFPACK_check(k == k2*2+kr);
         MMHelper<Field, MMHelperAlgo::Winograd, ModeT> HC(H);
+        HC.WS = H.WS;
         Protected::DynamicPeeling2 (F, ta, tb, m, n, k, mr, nr, kr, alpha, A, lda, B, ldb, beta, C, ldc, HC, Cmin, Cmax);
 #endif
         return C;
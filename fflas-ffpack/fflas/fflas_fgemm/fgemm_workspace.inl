@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_fgemm/fgemm_workspace.inl
+ * @brief Size of the Workspace needed by fgemm.
+ *
+ * The bounds below follow the allocations of fgemm_convert, of the
+ * Strassen-Winograd schedules and of the packed kernel, level by level,
+ * counting the alignment padding of each block. They are upper bounds,
+ * valid for any alpha and beta.
+ */
+
+#ifndef __FFLASFFPACK_fflas_fflas_fgemm_workspace_INL
+#define __FFLASFFPACK_fflas_fflas_fgemm_workspace_INL
+
+namespace FFLAS { namespace Protected {
+
+    //! Bytes taken in a Workspace by \p blocks blocks of \p elts elements of \p size bytes in total
+    inline size_t WorkspaceBytes (const size_t elts, const size_t size, const size_t blocks)
+    {
+        return elts*size + blocks*Workspace::alignment;
+    }
+
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+    template<class Field>
+    inline size_t PackedWorkspace (const Field&, const size_t m, const size_t n, const size_t k, std::true_type)
+    {
+        details::PackedBlocking<typename Field::Element> Blk (m, n, k, k, k);
+        return WorkspaceBytes (Blk.sizeA + Blk.sizeB, sizeof(typename Field::Element), 2);
+    }
+
+    template<class Field>
+    inline size_t PackedWorkspace (const Field&, const size_t, const size_t, const size_t, std::false_type)
+    {
+        return 0;
+    }
+#endif
+
+    //! Packing buffers of the classic products at the leaves of the recursion
+    template<class Field>
+    inline size_t PackedWorkspace (const Field& F, const size_t m, const size_t n, const size_t k)
+    {
+#if defined(__FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS)
+        return PackedWorkspace (F, m, n, k, typename PackedFgemmSupport<Field>::type());
+#else
+        return 0;
+#endif
+    }
+
+    /** Sequential Strassen-Winograd with w levels: the temporaries of every
+     * level are alive together, the largest of the 2 (beta = 0) and 3 (beta != 0)
+     * temporaries schedules is counted at each level.
+     */
+    template<class Field>
+    inline size_t WinogradWorkspace (const Field& F, const size_t m, const size_t n, const size_t k, int w)
+    {
+        if (w < 0) w = WinogradSteps (F, min3 (m, k, n));
+        size_t bytes = 0;
+        size_t mr = m/2, nr = n/2, kr = k/2;
+        for (; w > 0; --w, mr >>= 1, nr >>= 1, kr >>= 1)
+            bytes += WorkspaceBytes (std::max (WinogradSeqMemory (mr, nr, kr, 1, false),
+                                               WinogradSeqMemory (mr, nr, kr, 1, true)),
+                                     sizeof(typename Field::Element), 3);
+        return bytes + PackedWorkspace (F, m, n, k);
+    }
+
+    template<class Field, class ModeT>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k, const int w, ModeT)
+    {
+        return WinogradWorkspace (F, m, n, k, w);
+    }
+
+    template<class NewField, class Field>
+    inline size_t ConvertWorkspace (const Field& F, const size_t m, const size_t n, const size_t k, const int w)
+    {
+        NewField G((typename NewField::Element) F.characteristic());
+        return WorkspaceBytes (m*k + k*n + m*n, sizeof(typename NewField::Element), 3)
+        + fgemm_workspace (G, m, n, k, w, typename ModeTraits<NewField>::value());
+    }
+
+    // Same choice of a smaller field as fgemm in the delayed mode
+    template<class Field>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k, const int w,
+                                   ModeCategories::DelayedTag)
+    {
+        if (!std::is_same<Field,Givaro::Modular<float> >::value){
+            if (F.cardinality() == 2)
+                return ConvertWorkspace<Givaro::Modular<float> > (F, m, n, k, w);
+            else if (!std::is_same<Field,Givaro::ModularBalanced<float> >::value){
+                if (F.characteristic() < DOUBLE_TO_FLOAT_CROSSOVER)
+                    return ConvertWorkspace<Givaro::ModularBalanced<float> > (F, m, n, k, w);
+                else if (!std::is_same<Field,Givaro::ModularBalanced<double> >::value &&  16*F.cardinality() < Givaro::ModularBalanced<double>::maxCardinality())
+                    return ConvertWorkspace<Givaro::ModularBalanced<double> > (F, m, n, k, w);
+            }
+        }
+        return WinogradWorkspace (F, m, n, k, w);
+    }
+
+    template<class Field>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k, const int w,
+                                   ModeCategories::ConvertTo<ElementCategories::MachineFloatTag>)
+    {
+        return fgemm_workspace (F, m, n, k, w, ModeCategories::DelayedTag());
+    }
+
+    /** WinogradPar with w levels on nt threads: the 11 temporaries of WinoPar
+     * (12 when it accumulates in C), then the parts of the seven concurrent products.
+     */
+    template<class Field>
+    inline size_t WinogradParWorkspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                        const int w, const size_t nt)
+    {
+        if (w <= 0) return 0; // classic pfgemm, whose tasks do not use the arena
+        if (nt <= 1) return WinogradWorkspace (F, m, n, k, w);
+        const size_t mr = m/2, nr = n/2, kr = k/2;
+        const size_t ntmax = std::max (size_t(1), (nt+6)/7), ntmin = std::max (size_t(1), nt/7);
+        const size_t child = std::max (WinogradParWorkspace (F, mr, nr, kr, w-1, ntmax),
+                                       WinogradParWorkspace (F, mr, nr, kr, w-1, ntmin));
+        const size_t share = (child + Workspace::alignment - 1) / Workspace::alignment * Workspace::alignment;
+        const size_t level = WorkspaceBytes (WinoParMemory (mr, nr, kr, true), sizeof(typename Field::Element), 12)
+        + 7*share + Workspace::alignment;
+        // the peeling runs once the core product is done
+        return std::max (level, PackedWorkspace (F, m, n, k));
+    }
+
+    template<class Field, class ModeT, class ParSeqTrait>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                   const MMHelper<Field, MMHelperAlgo::Classic, ModeT, ParSeqTrait>& H)
+    {
+        return PackedWorkspace (F, m, n, k);
+    }
+
+    template<class Field, class ModeT, class ParSeqTrait>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                   const MMHelper<Field, MMHelperAlgo::Winograd, ModeT, ParSeqTrait>& H)
+    {
+        return fgemm_workspace (F, m, n, k, H.recLevel, ModeT());
+    }
+
+    template<class Field, class ModeT, class ParSeqTrait>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                   const MMHelper<Field, MMHelperAlgo::Auto, ModeT, ParSeqTrait>& H)
+    {
+        return fgemm_workspace (F, m, n, k, H.recLevel, ModeT());
+    }
+
+    template<class Field, class ModeT, class ParSeqTrait>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                   const MMHelper<Field, MMHelperAlgo::WinogradPar, ModeT, ParSeqTrait>& H)
+    {
+        const int w = (H.recLevel < 0) ? WinogradSteps (F, min3 (m, k, n)) : H.recLevel;
+        return WinogradParWorkspace (F, m, n, k, w, H.parseq.numthreads());
+    }
+
+} // Protected
+} // FFLAS
+
+namespace FFLAS {
+
+    template<class Field, class AlgoT, class ModeT, class ParSeqTrait>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                                   const MMHelper<Field, AlgoT, ModeT, ParSeqTrait>& H)
+    {
+        if (!m || !n || !k || !Protected::WorkspaceAllocatable<Field>::value)
+            return 0;
+        return Protected::fgemm_workspace (F, m, n, k, H);
+    }
+
+    template<class Field>
+    inline size_t fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k)
+    {
+        MMHelper<Field, MMHelperAlgo::Auto, typename ModeTraits<Field>::value, ParSeqHelper::Sequential> H (F, m, k, n, ParSeqHelper::Sequential());
+        return fgemm_workspace (F, m, n, k, H);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_fflas_fgemm_workspace_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -34,6 +34,31 @@
 #ifndef __FFLASFFPACK_fgemm_winograd_INL
 #define __FFLASFFPACK_fgemm_winograd_INL
 
+namespace FFLAS { namespace Protected {
+
+    /** Number of elements allocated by WinoPar for one level on mr x kr by kr x nr quarters,
+     * with one more mr x nr temporary if it accumulates in C (acc).
+     */
+    inline size_t WinoParMemory (const size_t mr, const size_t nr, const size_t kr, const bool acc = false)
+    {
+        return 4*kr*nr + 5*mr*std::max(nr,kr) + (acc ? 3 : 2)*mr*nr;
+    }
+
+    /** Number of elements allocated at most by w levels of the sequential
+     * Winograd (or WinogradAcc_3_21 if acc) schedules, starting on mr x kr by kr x nr quarters.
+     */
+    inline size_t WinogradSeqMemory (size_t mr, size_t nr, size_t kr, int w, const bool acc)
+    {
+        size_t mem = 0;
+        for (; w > 0; --w, mr >>= 1, nr >>= 1, kr >>= 1)
+            mem += acc ? std::max(mr,kr)*nr + mr*kr + mr*nr
+                       : kr*nr + mr*std::max(nr,kr);
+        return mem;
+    }
+
+} // Protected
+} // FFLAS
+
 namespace FFLAS { namespace BLAS3 {
 
     template < class Field, class FieldTrait, class Strat, class Param >
@@ -51,13 +76,29 @@ namespace FFLAS { namespace BLAS3 {
              MMHelper<Field, MMHelperAlgo::WinogradPar, FieldTrait, ParSeqHelper::Parallel<Strat,Param> > & WH
             )
     {
-        FFLASFFPACK_check(F.isZero(beta));
-
         //			typedef MMHelper<Field, MMHelperAlgo::WinogradPar, FieldTrait > MMH_t;
         typedef MMHelper<Field, MMHelperAlgo::WinogradPar, FieldTrait, ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> > MMH_t;
         const typename MMH_t::DelayedField & DF = WH.delayedField;
         typedef typename  MMH_t::DelayedField::Element DFElt;
 
+        // with beta != 0, P2, P3 and P4 accumulate in the quadrants of C they alone
+        // contribute to, and P5 is added to beta . C22
+        const bool acc = !F.isZero(beta);
+        typename Field::Element mbeta;
+        F.neg(mbeta,beta);
+        DFElt betadf;
+        DF.init(betadf);
+        if (F.isMOne(beta)) {
+            DF.assign(betadf, DF.mOne);
+        } else {
+            DF.assign(betadf, beta);
+        }
+        DFElt ACmin = 0, ACmax = 0;
+        if (acc) {
+            ACmin = WH.Cmin;
+            ACmax = WH.Cmax;
+        }
+
         size_t lb, cb, la, ca, ldX2;
         // size_t x3rd = std::max(mr,kr);
         typename Field::ConstElement_ptr A11=A, A12, A21, A22;
@@ -97,21 +138,34 @@ namespace FFLAS { namespace BLAS3 {
         }
 
         // 11 temporary submatrices are required
-        typename Field::Element_ptr X21 = fflas_new (F, kr, nr);
-        typename Field::Element_ptr X11 = fflas_new (F,mr,x1rd);
-
-        typename Field::Element_ptr X22 = fflas_new (F, kr, nr);
-        typename Field::Element_ptr X12 = fflas_new (F,mr,x1rd);
-
-        typename Field::Element_ptr X23 = fflas_new (F, kr, nr);
-        typename Field::Element_ptr X13 = fflas_new (F,mr,x1rd);
-
-        typename Field::Element_ptr X24 = fflas_new (F, kr, nr);
-        typename Field::Element_ptr X14 = fflas_new (F,mr,x1rd);
-        typename Field::Element_ptr X15 = fflas_new (F,mr,x1rd);
-
-        typename Field::Element_ptr C_11 = fflas_new (F,mr,nr);
-        typename Field::Element_ptr CC_11 = fflas_new (F,mr,nr);
+        typename Field::Element_ptr X21 = workspace_new (F, kr, nr, WH.WS);
+        typename Field::Element_ptr X11 = workspace_new (F, mr, x1rd, WH.WS);
+
+        typename Field::Element_ptr X22 = workspace_new (F, kr, nr, WH.WS);
+        typename Field::Element_ptr X12 = workspace_new (F, mr, x1rd, WH.WS);
+
+        typename Field::Element_ptr X23 = workspace_new (F, kr, nr, WH.WS);
+        typename Field::Element_ptr X13 = workspace_new (F, mr, x1rd, WH.WS);
+
+        typename Field::Element_ptr X24 = workspace_new (F, kr, nr, WH.WS);
+        typename Field::Element_ptr X14 = workspace_new (F, mr, x1rd, WH.WS);
+        typename Field::Element_ptr X15 = workspace_new (F, mr, x1rd, WH.WS);
+
+        typename Field::Element_ptr C_11 = workspace_new (F, mr, nr, WH.WS);
+        typename Field::Element_ptr CC_11 = workspace_new (F, mr, nr, WH.WS);
+        // and a 12th for P7 when accumulating
+        typename Field::Element_ptr X7 = C_11;
+        if (acc) X7 = workspace_new (F, mr, nr, WH.WS);
+
+        // the seven products run concurrently and share what remains of the budget,
+        // each in its own part of the arena
+        const size_t own = Protected::WinoParMemory (mr, nr, kr, acc) * sizeof(typename Field::Element);
+        const size_t subbudget = (WH.WorkspaceBudget > own) ? (WH.WorkspaceBudget - own) / 7 : 0;
+        const size_t share = WH.WS ? std::min (subbudget, WH.WS->available() / (7*Workspace::alignment) * Workspace::alignment) : 0;
+        char* shares = share ? static_cast<char*>(WH.WS->allocate (7*share)) : nullptr;
+        auto part = [&](size_t i) { return shares ? shares + i*share : nullptr; };
+        Workspace W1 (part(0), share), W2 (part(1), share), W3 (part(2), share), W4 (part(3), share);
+        Workspace W5 (part(4), share), W6 (part(5), share), W7 (part(6), share);
         SYNCH_GROUP(
 
                     // T3 = B22 - B12 in X21  and S3 = A11 - A21 in X11
@@ -123,7 +177,7 @@ namespace FFLAS { namespace BLAS3 {
                     // T1 = B12 - B11 in X22 and  S1 = A21 + A22 in X12
                     TASK(MODE(READ(B11, B12) WRITE(X22) CONSTREFERENCE(DF)),
                          pfsub(DF,lb,cb,B12,ldb,B11,ldb,X22,ldX2, NUM_THREADS););
-                    TASK(MODE(READ(A12, A22) WRITE(X12) CONSTREFERENCE(DF)),
+                    TASK(MODE(READ(A21, A22) WRITE(X12) CONSTREFERENCE(DF)),
                          pfadd(DF,la,ca,A21,lda,A22,lda,X12,ldX1, NUM_THREADS););
 
                     CHECK_DEPENDENCIES;
@@ -159,9 +213,9 @@ namespace FFLAS { namespace BLAS3 {
                     MMH_t H7(F, WH.recLevel-1, -(WH.Amax-WH.Amin), WH.Amax-WH.Amin, -(WH.Bmax-WH.Bmin), WH.Bmax-WH.Bmin, 0,0);
                     MMH_t H5(F, WH.recLevel-1, 2*WH.Amin, 2*WH.Amax, -(WH.Bmax-WH.Bmin), WH.Bmax-WH.Bmin, 0, 0);
                     MMH_t H6(F, WH.recLevel-1, 2*WH.Amin-WH.Amax, 2*WH.Amax-WH.Amin, 2*WH.Bmin-WH.Bmax, 2*WH.Bmax-WH.Bmin, 0, 0);
-                    MMH_t H3(F, WH.recLevel-1, 2*WH.Amin-2*WH.Amax, 2*WH.Amax-2*WH.Amin, WH.Bmin, WH.Bmax, 0, 0);
-                    MMH_t H4(F, WH.recLevel-1, WH.Amin, WH.Amax, 2*WH.Bmin-2*WH.Bmax, 2*WH.Bmax-2*WH.Bmin, 0, 0);
-                    MMH_t H2(F, WH.recLevel-1, WH.Amin, WH.Amax, WH.Bmin, WH.Bmax, 0, 0);
+                    MMH_t H3(F, WH.recLevel-1, 2*WH.Amin-2*WH.Amax, 2*WH.Amax-2*WH.Amin, WH.Bmin, WH.Bmax, ACmin, ACmax);
+                    MMH_t H4(F, WH.recLevel-1, WH.Amin, WH.Amax, 2*WH.Bmin-2*WH.Bmax, 2*WH.Bmax-2*WH.Bmin, ACmin, ACmax);
+                    MMH_t H2(F, WH.recLevel-1, WH.Amin, WH.Amax, WH.Bmin, WH.Bmax, ACmin, ACmax);
 
                     size_t nt = WH.parseq.numthreads();
                     size_t nt_rec = nt/7;
@@ -174,148 +228,295 @@ namespace FFLAS { namespace BLAS3 {
                     H6.parseq.set_numthreads(std::max(size_t(1),nt_rec + ((nt_mod-- > 0)?1:0)));
                     H7.parseq.set_numthreads(std::max(size_t(1),nt_rec + ((nt_mod-- > 0)?1:0)));
 
-                    TASK(MODE(READ(A11, B11) WRITE(X15) CONSTREFERENCE(F,H1)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, A11, lda, B11, ldb, F.zero, X15, x1rd, H1););
-                    // P7 = alpha . S3 * T3  in C21
-                    TASK(MODE(READ(X11, X21) WRITE(C21) CONSTREFERENCE(F,H7)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, X11, ldX1, X21, ldX2, F.zero, C21, ldc, H7););
-
-                    // P5 = alpha . S1*T1 in C22
-                    TASK(MODE(READ(X12, X22) WRITE(C22) CONSTREFERENCE(F,H5)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, X12, ldX1, X22, ldX2, F.zero, C22, ldc, H5););
-
-                    // P6 = alpha . S2 * T2 in C12
-                    TASK(MODE(READ(X13, X23) WRITE(C12) CONSTREFERENCE(F,H6)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, X13, ldX1, X23, ldX2, F.zero, C12, ldc, H6););
-
-                    // P3 = alpha . S4*B22 in CC_11
-                    TASK(MODE(READ(X14, B22) WRITE(CC_11) CONSTREFERENCE(F,H3)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, X14, ldX1, B22, ldb, F.zero, CC_11, nr, H3););
-
-                    // P4 = alpha . A22 * T4 in C_11
-                    TASK(MODE(READ(A22) WRITE(C_11) READWRITE(X24, X22, X23, X21) CONSTREFERENCE(F,H4)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, A22, lda, X24, ldX2, F.zero, C_11, nr, H4);
-                        );
+                    H1.WorkspaceBudget = H2.WorkspaceBudget = H3.WorkspaceBudget = H4.WorkspaceBudget = subbudget;
+                    H5.WorkspaceBudget = H6.WorkspaceBudget = H7.WorkspaceBudget = subbudget;
+                    H1.WS = &W1; H2.WS = &W2; H3.WS = &W3; H4.WS = &W4;
+                    H5.WS = &W5; H6.WS = &W6; H7.WS = &W7;
+
+                    if (acc) {
+                        // P1 = alpha . A11 * B11 in X15
+                        TASK(MODE(READ(A11, B11) WRITE(X15) CONSTREFERENCE(F,H1)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A11, lda, B11, ldb, F.zero, X15, x1rd, H1););
+                        // P7 = alpha . S3 * T3 in X7
+                        TASK(MODE(READ(X11, X21) WRITE(X7) CONSTREFERENCE(F,H7)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X11, ldX1, X21, ldX2, F.zero, X7, nr, H7););
+                        // P5 = alpha . S1*T1 in CC_11
+                        TASK(MODE(READ(X12, X22) WRITE(CC_11) CONSTREFERENCE(F,H5)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X12, ldX1, X22, ldX2, F.zero, CC_11, nr, H5););
+                        // P6 = alpha . S2 * T2 in C_11
+                        TASK(MODE(READ(X13, X23) WRITE(C_11) CONSTREFERENCE(F,H6)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X13, ldX1, X23, ldX2, F.zero, C_11, nr, H6););
+                        // P3 + beta . C12 = alpha . S4*B22 + beta . C12 in C12
+                        TASK(MODE(READ(X14, B22) READWRITE(C12) CONSTREFERENCE(F,H3)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X14, ldX1, B22, ldb, beta, C12, ldc, H3););
+                        // P4 - beta . C21 = alpha . A22 * T4 - beta . C21 in C21
+                        TASK(MODE(READ(A22, X24) READWRITE(C21) CONSTREFERENCE(F,H4)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A22, lda, X24, ldX2, mbeta, C21, ldc, H4););
+                        // P2 + beta . C11 = alpha . A12 * B21 + beta . C11 in C11
+                        TASK(MODE(READ(A12, B21) READWRITE(C11) CONSTREFERENCE(F,H2)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A12, lda, B21, ldb, beta, C11, ldc, H2););
+                    } else {
+                        TASK(MODE(READ(A11, B11) WRITE(X15) CONSTREFERENCE(F,H1)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A11, lda, B11, ldb, F.zero, X15, x1rd, H1););
+                        // P7 = alpha . S3 * T3  in C21
+                        TASK(MODE(READ(X11, X21) WRITE(C21) CONSTREFERENCE(F,H7)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X11, ldX1, X21, ldX2, F.zero, C21, ldc, H7););
+
+                        // P5 = alpha . S1*T1 in C22
+                        TASK(MODE(READ(X12, X22) WRITE(C22) CONSTREFERENCE(F,H5)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X12, ldX1, X22, ldX2, F.zero, C22, ldc, H5););
+
+                        // P6 = alpha . S2 * T2 in C12
+                        TASK(MODE(READ(X13, X23) WRITE(C12) CONSTREFERENCE(F,H6)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X13, ldX1, X23, ldX2, F.zero, C12, ldc, H6););
+
+                        // P3 = alpha . S4*B22 in CC_11
+                        TASK(MODE(READ(X14, B22) WRITE(CC_11) CONSTREFERENCE(F,H3)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, X14, ldX1, B22, ldb, F.zero, CC_11, nr, H3););
+
+                        // P4 = alpha . A22 * T4 in C_11
+                        TASK(MODE(READ(A22, X24) WRITE(C_11) CONSTREFERENCE(F,H4)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A22, lda, X24, ldX2, F.zero, C_11, nr, H4);
+                            );
 
-                    // P2 = alpha . A12 * B21  in C11
-                    TASK(MODE(READ(A12, B21) WRITE(C11) CONSTREFERENCE(F,H2)),
-                         fgemm (F, ta, tb, mr, nr, kr, alpha, A12, lda, B21, ldb, F.zero, C11, ldc, H2););
-                    CHECK_DEPENDENCIES;
+                        // P2 = alpha . A12 * B21  in C11
+                        TASK(MODE(READ(A12, B21) WRITE(C11) CONSTREFERENCE(F,H2)),
+                             fgemm (F, ta, tb, mr, nr, kr, alpha, A12, lda, B21, ldb, F.zero, C11, ldc, H2););
+                    }
+                    // the output bounds of the seven products are read below: a true barrier
+                    WAIT;
 
-                    DFElt U2Min, U2Max;
-                    DFElt U3Min, U3Max;
-                    DFElt U4Min, U4Max;
-                    DFElt U7Min, U7Max;
+                    DFElt U1Min, U1Max;
                     DFElt U5Min, U5Max;
-                    // U2 = P1 + P6 in C12  and
-                    // U3 = P7 + U2 in C21  and
-                    // U4 = P5 + U2 in C12    and
-                    // U7 = P5 + U3 in C22    and
-                    // U5 = P3 + U4 in C12
-                    // BIG TASK with 5 Addin function calls
-                    //		TASK(MODE(READWRITE(X15, C12) CONSTREFERENCE(F, DF, WH, U2Min, U2Max, H1.Outmin, H1.Outmax, H6.Outmin, H6.Outmax)),
-                    if (Protected::NeedPreAddReduction(U2Min, U2Max, H1.Outmin, H1.Outmax, H6.Outmin, H6.Outmax, WH)){
-                        TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, x1rd, X15, x1rd, NUM_THREADS);
+                    DFElt U6Min, U6Max;
+                    DFElt U7Min, U7Max;
+                    if (acc) {
+                        DFElt U2Min, U2Max;
+                        DFElt U3Min, U3Max;
+                        DFElt U4Min, U4Max;
+                        DFElt C22Min, C22Max;
+                        // V = P5 + beta . C22 in C22
+                        if (Protected::NeedDoublePreAddReduction (C22Min, C22Max, H5.Outmin, H5.Outmax, WH.Cmin, WH.Cmax, betadf, WH)){
+                            TASK(MODE(READWRITE(CC_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, CC_11, nr, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                            H5.initOut();
+                        }
+                        TASK(MODE(READ(CC_11) READWRITE(C22) CONSTREFERENCE(DF, betadf)),
+                             fadd (DF, mr, nr, CC_11, nr, betadf, C22, ldc, C22, ldc);
                             );
-                        TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                        CHECK_DEPENDENCIES;
+                        // U2 = P1 + P6 in C_11
+                        if (Protected::NeedPreAddReduction (U2Min, U2Max, H1.Outmin, H1.Outmax, H6.Outmin, H6.Outmax, WH)){
+                            TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X15, x1rd, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C_11, nr, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(X15) READWRITE(C_11) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, X15, x1rd, C_11, nr, NUM_THREADS);
                             );
                         CHECK_DEPENDENCIES;
-                    }
-                    TASK(MODE(READWRITE(X15, C12) CONSTREFERENCE(DF)),
-                         pfaddin(DF,mr,nr,X15,x1rd,C12,ldc, NUM_THREADS);
-                        );
-                    CHECK_DEPENDENCIES;
-                    //		TASK(MODE(READWRITE(C12, C21) CONSTREFERENCE(F, DF, WH, U3Min, U3Max, U2Min, U2Max)),
-                    if (Protected::NeedPreAddReduction(U3Min, U3Max, U2Min, U2Max, H7.Outmin, H7.Outmax, WH)){
-                        TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                        // U1 = P1 + P2 + beta . C11 in C11
+                        if (Protected::NeedPreAddReduction (U1Min, U1Max, H1.Outmin, H1.Outmax, H2.Outmin, H2.Outmax, WH)){
+                            TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X15, x1rd, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C11, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(X15) READWRITE(C11) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, X15, x1rd, C11, ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                        CHECK_DEPENDENCIES;
+                        // U3 = U2 + P7 in X7
+                        if (Protected::NeedPreAddReduction (U3Min, U3Max, U2Min, U2Max, H7.Outmin, H7.Outmax, WH)){
+                            TASK(MODE(READWRITE(C_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C_11, nr, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(X7) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X7, nr, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(C_11) READWRITE(X7) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, C_11, nr, X7, nr, NUM_THREADS);
                             );
                         CHECK_DEPENDENCIES;
-                    }
-                    TASK(MODE(READWRITE(C12, C21) CONSTREFERENCE(DF)),
-                         pfaddin(DF,mr,nr,C12,ldc,C21,ldc, NUM_THREADS);
-                        );
-                    CHECK_DEPENDENCIES;
-                    //		TASK(MODE(READWRITE(C12, C22) CONSTREFERENCE(F, DF, WH) VALUE(U4Min, U4Max, U2Min, U2Max)),
-                    if (Protected::NeedPreAddReduction(U4Min, U4Max, U2Min, U2Max, H5.Outmin, H5.Outmax, WH)){
-                        TASK(MODE(READWRITE(C22) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C22, ldc, NUM_THREADS);
+                        // U4 = U2 + P3 + beta . C12 in C12
+                        if (Protected::NeedPreAddReduction (U4Min, U4Max, U2Min, U2Max, H3.Outmin, H3.Outmax, WH)){
+                            TASK(MODE(READWRITE(C_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C_11, nr, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(C_11) READWRITE(C12) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, C_11, nr, C12, ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                        CHECK_DEPENDENCIES;
+                        // U5 = U4 + P5 in C12
+                        if (Protected::NeedPreAddReduction (U5Min, U5Max, U4Min, U4Max, H5.Outmin, H5.Outmax, WH)){
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(CC_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, CC_11, nr, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(CC_11) READWRITE(C12) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, CC_11, nr, C12, ldc, NUM_THREADS);
                             );
                         CHECK_DEPENDENCIES;
-                    }
-                    TASK(MODE(READWRITE(C12, C22) CONSTREFERENCE(DF, WH)),
-                         pfaddin(DF,mr,nr,C22,ldc,C12,ldc, NUM_THREADS);
-                        );
-                    CHECK_DEPENDENCIES;
-                    //		TASK(MODE(READWRITE(C22, C21) CONSTREFERENCE(F, DF, WH) VALUE(U3Min, U3Max, U7Min, U7Max)),
-                    if (Protected::NeedPreAddReduction (U7Min,U7Max, U3Min, U3Max, H5.Outmin,H5.Outmax, WH) ){
-                        TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                        // U7 = U3 + V in C22
+                        if (Protected::NeedPreAddReduction (U7Min, U7Max, U3Min, U3Max, C22Min, C22Max, WH)){
+                            TASK(MODE(READWRITE(X7) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X7, nr, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C22) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C22, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(X7) READWRITE(C22) CONSTREFERENCE(DF)),
+                             pfaddin (DF, mr, nr, X7, nr, C22, ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(C22) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C22, ldc, NUM_THREADS);
+                        CHECK_DEPENDENCIES;
+                        // U6 = U3 - (P4 - beta . C21) in C21
+                        if (Protected::NeedPreSubReduction (U6Min, U6Max, U3Min, U3Max, H4.Outmin, H4.Outmax, WH)){
+                            TASK(MODE(READWRITE(X7) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X7, nr, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READ(X7) READWRITE(C21) CONSTREFERENCE(DF)),
+                             pfsub (DF, mr, nr, X7, nr, C21, ldc, C21, ldc, NUM_THREADS);
                             );
                         CHECK_DEPENDENCIES;
-                    }
-                    TASK(MODE(READWRITE(C22, C21) CONSTREFERENCE(DF, WH)),
-                         pfaddin(DF,mr,nr,C21,ldc,C22,ldc, NUM_THREADS);
-                        );
-                    //		TASK(MODE(READWRITE(C12, CC_11) CONSTREFERENCE(F, DF, WH) VALUE(U5Min, U5Max, U4Min, U4Max)),
-                    if (Protected::NeedPreAddReduction (U5Min,U5Max, U4Min, U4Max, H3.Outmin, H3.Outmax, WH) ){
-                        TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                    } else {
+                        DFElt U2Min, U2Max;
+                        DFElt U3Min, U3Max;
+                        DFElt U4Min, U4Max;
+                        // U2 = P1 + P6 in C12  and
+                        // U3 = P7 + U2 in C21  and
+                        // U4 = P5 + U2 in C12    and
+                        // U7 = P5 + U3 in C22    and
+                        // U5 = P3 + U4 in C12
+                        // BIG TASK with 5 Addin function calls
+                        //		TASK(MODE(READWRITE(X15, C12) CONSTREFERENCE(F, DF, WH, U2Min, U2Max, H1.Outmin, H1.Outmax, H6.Outmin, H6.Outmax)),
+                        if (Protected::NeedPreAddReduction(U2Min, U2Max, H1.Outmin, H1.Outmax, H6.Outmin, H6.Outmax, WH)){
+                            TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, x1rd, X15, x1rd, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READWRITE(X15, C12) CONSTREFERENCE(DF)),
+                             pfaddin(DF,mr,nr,X15,x1rd,C12,ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(CC_11) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, CC_11, nr, NUM_THREADS);
+                        CHECK_DEPENDENCIES;
+                        //		TASK(MODE(READWRITE(C12, C21) CONSTREFERENCE(F, DF, WH, U3Min, U3Max, U2Min, U2Max)),
+                        if (Protected::NeedPreAddReduction(U3Min, U3Max, U2Min, U2Max, H7.Outmin, H7.Outmax, WH)){
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READWRITE(C12, C21) CONSTREFERENCE(DF)),
+                             pfaddin(DF,mr,nr,C12,ldc,C21,ldc, NUM_THREADS);
                             );
                         CHECK_DEPENDENCIES;
-                    }
-                    TASK(MODE(READWRITE(C12, CC_11) CONSTREFERENCE(DF, WH)),
-                         pfaddin(DF,mr,nr,CC_11,nr,C12,ldc, NUM_THREADS);
-                        );
-                    CHECK_DEPENDENCIES;
-
-                    // U6 = U3 - P4 in C21
-                    DFElt U6Min, U6Max;
-                    //		TASK(MODE(READWRITE(C_11, C21) CONSTREFERENCE(F, DF, WH) VALUE(U6Min, U6Max, U3Min, U3Max)),
-                    if (Protected::NeedPreSubReduction (U6Min,U6Max, U3Min, U3Max, H4.Outmin,H4.Outmax, WH) ){
-                        TASK(MODE(READWRITE(CC_11) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C_11, nr, NUM_THREADS);
+                        //		TASK(MODE(READWRITE(C12, C22) CONSTREFERENCE(F, DF, WH) VALUE(U4Min, U4Max, U2Min, U2Max)),
+                        if (Protected::NeedPreAddReduction(U4Min, U4Max, U2Min, U2Max, H5.Outmin, H5.Outmax, WH)){
+                            TASK(MODE(READWRITE(C22) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C22, ldc, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READWRITE(C12, C22) CONSTREFERENCE(DF, WH)),
+                             pfaddin(DF,mr,nr,C22,ldc,C12,ldc, NUM_THREADS);
+                            );
+                        CHECK_DEPENDENCIES;
+                        //		TASK(MODE(READWRITE(C22, C21) CONSTREFERENCE(F, DF, WH) VALUE(U3Min, U3Max, U7Min, U7Max)),
+                        if (Protected::NeedPreAddReduction (U7Min,U7Max, U3Min, U3Max, H5.Outmin,H5.Outmax, WH) ){
+                            TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C22) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C22, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READWRITE(C22, C21) CONSTREFERENCE(DF, WH)),
+                             pfaddin(DF,mr,nr,C21,ldc,C22,ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                        //		TASK(MODE(READWRITE(C12, CC_11) CONSTREFERENCE(F, DF, WH) VALUE(U5Min, U5Max, U4Min, U4Max)),
+                        if (Protected::NeedPreAddReduction (U5Min,U5Max, U4Min, U4Max, H3.Outmin, H3.Outmax, WH) ){
+                            TASK(MODE(READWRITE(C12) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C12, ldc, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(CC_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, CC_11, nr, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES;
+                        }
+                        TASK(MODE(READWRITE(C12, CC_11) CONSTREFERENCE(DF, WH)),
+                             pfaddin(DF,mr,nr,CC_11,nr,C12,ldc, NUM_THREADS);
                             );
-                        CHECK_DEPENDENCIES
-                    }
-                    TASK(MODE(READWRITE(C_11, C21) CONSTREFERENCE(DF, WH) ),
-                         pfsubin(DF,mr,nr,C_11,nr,C21,ldc, NUM_THREADS);
-                        );
-
-                    //CHECK_DEPENDENCIES;
+                        CHECK_DEPENDENCIES;
 
-                    //  U1 = P2 + P1 in C11
-                    DFElt U1Min, U1Max;
-                    //		TASK(MODE(READWRITE(C11, X15/*, X14, X13, X12, X11*/) CONSTREFERENCE(F, DF, WH) VALUE(U1Min, U1Max)),
-                    if (Protected::NeedPreAddReduction (U1Min, U1Max, H1.Outmin, H1.Outmax, H2.Outmin,H2.Outmax, WH) ){
-                        TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, X15, x1rd, NUM_THREADS);
+                        // U6 = U3 - P4 in C21
+                        //		TASK(MODE(READWRITE(C_11, C21) CONSTREFERENCE(F, DF, WH) VALUE(U6Min, U6Max, U3Min, U3Max)),
+                        if (Protected::NeedPreSubReduction (U6Min,U6Max, U3Min, U3Max, H4.Outmin,H4.Outmax, WH) ){
+                            TASK(MODE(READWRITE(C_11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C_11, nr, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C21) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C21, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES
+                        }
+                        TASK(MODE(READWRITE(C_11, C21) CONSTREFERENCE(DF, WH) ),
+                             pfsubin(DF,mr,nr,C_11,nr,C21,ldc, NUM_THREADS);
                             );
-                        TASK(MODE(READWRITE(C11) CONSTREFERENCE(F)),
-                             pfreduce (F, mr, nr, C11, ldc, NUM_THREADS);
+
+                        //CHECK_DEPENDENCIES;
+
+                        //  U1 = P2 + P1 in C11
+                        //		TASK(MODE(READWRITE(C11, X15/*, X14, X13, X12, X11*/) CONSTREFERENCE(F, DF, WH) VALUE(U1Min, U1Max)),
+                        if (Protected::NeedPreAddReduction (U1Min, U1Max, H1.Outmin, H1.Outmax, H2.Outmin,H2.Outmax, WH) ){
+                            TASK(MODE(READWRITE(X15) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, X15, x1rd, NUM_THREADS);
+                                );
+                            TASK(MODE(READWRITE(C11) CONSTREFERENCE(F)),
+                                 pfreduce (F, mr, nr, C11, ldc, NUM_THREADS);
+                                );
+                            CHECK_DEPENDENCIES
+                        }
+                        TASK(MODE(READWRITE(C11, X15) CONSTREFERENCE(DF, WH)),
+                             pfaddin(DF,mr,nr,X15,x1rd,C11,ldc, NUM_THREADS);
                             );
-                        CHECK_DEPENDENCIES
                     }
-                    TASK(MODE(READWRITE(C11, X15) CONSTREFERENCE(DF, WH)),
-                         pfaddin(DF,mr,nr,X15,x1rd,C11,ldc, NUM_THREADS);
-                        );
 
                     WH.Outmin = std::min (U1Min, std::min (U5Min, std::min (U6Min, U7Min)));
                     WH.Outmax = std::max (U1Max, std::max (U5Max, std::max (U6Max, U7Max)));
@@ -324,17 +525,9 @@ namespace FFLAS { namespace BLAS3 {
                     //			WAIT;
 
 
-                    fflas_delete (CC_11);
-                    fflas_delete (C_11);
-                    fflas_delete (X15);
-                    fflas_delete (X14);
-                    fflas_delete (X24);
-                    fflas_delete (X13);
-                    fflas_delete (X23);
-                    fflas_delete (X12);
-                    fflas_delete (X22);
-                    fflas_delete (X11);
-                    fflas_delete (X21);
+                    if (shares) WH.WS->release (shares);
+                    if (acc) workspace_delete (WH.WS, X7);
+                    workspace_delete (WH.WS, CC_11, C_11, X15, X14, X24, X13, X23, X12, X22, X11, X21);
 
                     return C;
     } //wino parallel
@@ -401,13 +594,13 @@ namespace FFLAS { namespace BLAS3 {
             ldX2 = cb = nr;
         }
         // Two temporary submatrices are required
-        typename Field::Element_ptr X2 = fflas_new (F, kr, nr);
+        typename Field::Element_ptr X2 = workspace_new (F, kr, nr, WH.WS);
 
         // T3 = B22 - B12 in X2
         fsub(DF,lb,cb, (DFCEptr) B22,ldb, (DFCEptr) B12,ldb, (DFEptr)X2,ldX2);
 
         // S3 = A11 - A21 in X1
-        typename Field::Element_ptr X1 = fflas_new (F,mr,x1rd);
+        typename Field::Element_ptr X1 = workspace_new (F, mr, x1rd, WH.WS);
         fsub(DF,la,ca,(DFCEptr)A11,lda,(DFCEptr)A21,lda,(DFEptr)X1,ldX1);
 
         // P7 = alpha . S3 * T3  in C21
@@ -503,7 +696,7 @@ namespace FFLAS { namespace BLAS3 {
 
         fgemm (F, ta, tb, mr, nr, kr, alpha, A22, lda, X2, ldX2, F.zero, C11, ldc, H4);
 
-        fflas_delete (X2);
+        workspace_delete (WH.WS, X2);
 
         // U6 = U3 - P4 in C21
         DFElt U6Min, U6Max;
@@ -528,7 +721,7 @@ namespace FFLAS { namespace BLAS3 {
         }
         faddin(DF,mr,nr,(DFCEptr)X1,nr,(DFEptr)C11,ldc);
 
-        fflas_delete (X1);
+        workspace_delete (WH.WS, X1);
 
         WH.Outmin = std::min (U1Min, std::min (U5Min, std::min (U6Min, U7Min)));
         WH.Outmax = std::max (U1Max, std::max (U5Max, std::max (U6Max, U7Max)));
@@ -103,12 +103,12 @@ namespace FFLAS { namespace BLAS3 {
         // P2 = alpha . A12 * B21 + beta . C11  in C11
         fgemm (F, ta, tb, mr, nr, kr, alpha, A12, lda, B21, ldb, beta, C11, ldc, H);
 
-        typename Field::Element_ptr X3 = fflas_new (F, x3rd, nr);
+        typename Field::Element_ptr X3 = workspace_new (F, x3rd, nr, WH.WS);
 
         // T3 = B22 - B12 in X3
         fsub(F,lb,cb,B22,ldb,B12,ldb,X3,ldX3);
 
-        typename Field::Element_ptr X2 = fflas_new (F, mr, kr);
+        typename Field::Element_ptr X2 = workspace_new (F, mr, kr, WH.WS);
 
         // S3 = A11 - A21 in X2
         fsub(F,la,ca,A11,lda,A21,lda,X2,ca);
@@ -137,7 +137,7 @@ namespace FFLAS { namespace BLAS3 {
         // S2 = S1 - A11 in X2
         fsubin(F,la,ca,A11,lda,X2,ca);
 
-        typename Field::Element_ptr X1 = fflas_new (F, mr, nr);
+        typename Field::Element_ptr X1 = workspace_new (F, mr, nr, WH.WS);
 
         // P6 = alpha . S2 * T2 in X1
         fgemm (F, ta, tb, mr, nr, kr, alpha, X2, ca, X3, ldX3, F.zero, X1, nr, H);
@@ -169,17 +169,17 @@ namespace FFLAS { namespace BLAS3 {
         // U4 = P5 + U2 in C12    and
         faddin(F, mr, nr, X1, nr, C12, ldc);
 
-        fflas_delete (X1);
+        workspace_delete (WH.WS, X1);
 
         // U6 = U3 - P4 in C21    and
         fsub(F, mr, nr, X3, nr, C21, ldc, C21, ldc);
 
-        fflas_delete (X3);
+        workspace_delete (WH.WS, X3);
 
         // P3 = alpha . S4*B22 in X1
         fgemm (F, ta, tb, mr, nr, kr, alpha, X2, ca, B22, ldb, F.one, C12, ldc, H);
 
-        fflas_delete (X2);
+        workspace_delete (WH.WS, X2);
 
     } // WinogradAccOld
 
@@ -253,17 +253,17 @@ namespace FFLAS { namespace BLAS3 {
         }
 
         // Three temporary submatrices are required
-        typename Field::Element_ptr X3 = fflas_new (F, x3rd, nr);
+        typename Field::Element_ptr X3 = workspace_new (F, x3rd, nr, WH.WS);
 
         // T1 = B12 - B11 in X3
         fsub(DF,lb,cb,(DFCEptr)B12,ldb,(DFCEptr)B11,ldb,(DFEptr)X3,ldX3);
 
-        typename Field::Element_ptr X2 = fflas_new(F,mr,kr);
+        typename Field::Element_ptr X2 = workspace_new (F, mr, kr, WH.WS);
 
         // S1 = A21 + A22 in X2
         fadd(DF,la,ca,(DFCEptr)A21,lda,(DFCEptr)A22,lda,(DFEptr)X2,ca);
 
-        typename Field::Element_ptr X1 = fflas_new(F,mr,nr);
+        typename Field::Element_ptr X1 = workspace_new (F, mr, nr, WH.WS);
         // P5 = alpha . S1*T1  in X1
         MMH_t H5(F, WH.recLevel-1,
                  2*WH.Amin, 2*WH.Amax,
@@ -363,8 +363,8 @@ namespace FFLAS { namespace BLAS3 {
                  H6.Outmin, H6.Outmax);
         fgemm (F, ta, tb, mr, nr, kr, alpha, X2, ca, X3, ldX3, F.one, X1, nr, H7);
 
-        fflas_delete (X2);
-        fflas_delete (X3);
+        workspace_delete (WH.WS, X2);
+        workspace_delete (WH.WS, X3);
 
         // U7 =  U3 + C22 in C22
         DFElt U7Min, U7Max;
@@ -382,7 +382,7 @@ namespace FFLAS { namespace BLAS3 {
         }
         fsub(DF,mr,nr,(DFCEptr)X1,nr,(DFCEptr)C21,ldc,(DFEptr)C21,ldc);
 
-        fflas_delete (X1);
+        workspace_delete (WH.WS, X1);
 
         // Updating WH with Outmin, Outmax of the result
         WH.Outmin = min4 (U1Min, H3.Outmin, U6Min, U7Min);
@@ -460,10 +460,10 @@ namespace FFLAS { namespace BLAS3 {
         // Z3 = C12-C21           in C12
         fsubin(F,mr,nr,C21,ldc,C12,ldc);
         // S1 = A21 + A22         in X
-        typename Field::Element_ptr X = fflas_new(F,mr,std::max(nr,kr));
+        typename Field::Element_ptr X = workspace_new (F, mr, std::max(nr,kr), WH.WS);
         fadd(F,la,ca,A21,lda,A22,lda,X,ca);
         // T1 = B12 - B11         in Y
-        typename Field::Element_ptr Y = fflas_new(F,nr,kr);
+        typename Field::Element_ptr Y = workspace_new (F, nr, kr, WH.WS);
         fsub(F,lb,cb,B12,ldb,B11,ldb,Y,cb);
         // P5 = a S1 T1 + b Z3    in C12
         fgemm (F, ta, tb, mr, nr, kr, alpha, X, ca, Y, cb, beta, C12, ldc, H);
@@ -495,7 +495,7 @@ namespace FFLAS { namespace BLAS3 {
         fsub(F,lb,cb,B22,ldb,B12,ldb,Y,cb);
         // U3 = a S3 T3 + U2      in C21
         fgemm (F, ta, tb, mr, nr, kr, alpha, X, ca, Y, cb, F.one, C21, ldc, H);
-        fflas_delete (X);
+        workspace_delete (WH.WS, X);
         // U7 = U3 + W1           in C22
         faddin(F,mr,nr,C21,ldc,C22,ldc);
         // T1_ = B12 - B11        in Y
@@ -506,7 +506,7 @@ namespace FFLAS { namespace BLAS3 {
         fsub(F,lb,cb,Y,cb,B21,ldb,Y,cb);
         // U6 = -a A22 T4 + U3    in C21;
         fgemm (F, ta, tb, mr, nr, kr, malpha, A22, lda, Y, cb, F.one, C21, ldc, H);
-        fflas_delete (Y);
+        workspace_delete (WH.WS, Y);
 
 
     } // WinogradAccOld
@@ -580,10 +580,10 @@ namespace FFLAS { namespace BLAS3 {
         // Z3 = C12-C21           in C12
         fsubin(F,mr,nr,C21,ldc,C12,ldc);
         // S1 = A21 + A22         in X
-        typename Field::Element_ptr X = fflas_new(F,mr,std::max(nr,kr));
+        typename Field::Element_ptr X = workspace_new (F, mr, std::max(nr,kr), WH.WS);
         fadd(F,la,ca,A21,lda,A22,lda,X,ca);
         // T1 = B12 - B11         in Y
-        typename Field::Element_ptr Y = fflas_new(F,nr,std::max(kr,mr));
+        typename Field::Element_ptr Y = workspace_new (F, nr, std::max(kr,mr), WH.WS);
         fsub(F,lb,cb,B12,ldb,B11,ldb,Y,cb);
         // P5 = a S1 T1 + b Z3    in C12
         fgemm (F, ta, tb, mr, nr, kr, alpha, X, ca, Y, cb, beta, C12, ldc, H);
@@ -627,9 +627,9 @@ namespace FFLAS { namespace BLAS3 {
         fsub(F,lb,cb,Y,cb,B21,ldb,Y,cb);
         // U6 = -a A22 T4 + U3    in C21;
         fgemm (F, ta, tb, mr, nr, kr, alpha, A22, lda, Y, cb, F.zero, X, nr, H);
-        fflas_delete (Y);
+        workspace_delete (WH.WS, Y);
         fsub(F,mr,nr,C21,ldc,X,nr,C21,ldc);
-        fflas_delete (X);
+        workspace_delete (WH.WS, X);
 
 
     } // WinogradAcc3
@@ -96,7 +96,8 @@ namespace FFLAS {
            typename Field::Element_ptr B, const size_t ldb,
            const ParSeqHelper::Parallel<Cut,Param>& PSH)
     {
-        TRSMHelper<StructureHelper::Iterative, ParSeqHelper::Parallel<Cut,Param> > H(PSH);
+        // the Hybrid structure falls back to cutting A when B has too few columns (or rows) for the threads
+        TRSMHelper<StructureHelper::Hybrid, ParSeqHelper::Parallel<Cut,Param> > H(PSH);
         ftrsm(F, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb, H);
     }
 
@@ -177,6 +178,26 @@ namespace FFLAS {
 
     }
 
+    /** @brief ftrsm_workspace: bytes of Workspace enough for a sequential ftrsm.
+     *
+     * Covers the copy of the diagonal blocks and the updates, done by fgemm over
+     * \p F and over its delayed domain; attached to \p H.WS, such a Workspace
+     * holds every temporary of the recursive ftrsm with this Side, M and N.
+     */
+    template<class Field>
+    inline size_t
+    ftrsm_workspace (const Field& F, const FFLAS_SIDE Side, const size_t M, const size_t N,
+                     const TRSMHelper<StructureHelper::Recursive, ParSeqHelper::Sequential> & H)
+    {
+        if (!M || !N || !Protected::WorkspaceAllocatable<Field>::value)
+            return 0;
+        typename associatedDelayedField<const Field>::field D(F);
+        const size_t Na = (Side == FflasLeft) ? M : N;
+        const size_t nb = std::min (Na, Protected::TRSMBound<Field> (F));
+        return Protected::WorkspaceBytes (nb*nb, sizeof(typename Field::Element), 1)
+        + std::max (fgemm_workspace (F, M, N, Na), fgemm_workspace (D, M, N, Na));
+    }
+
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
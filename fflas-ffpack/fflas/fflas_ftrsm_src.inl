@@ -222,7 +222,7 @@ public:
 #ifdef __FFLAS__TRSM_READONLY
             //! @warning this is C99 (-Wno-vla)
             //typename Field::Element Acop[__FFLAS__Na*__FFLAS__Na];
-            typename Field::Element_ptr Acop = FFLAS::fflas_new(F,__FFLAS__Na,__FFLAS__Na);
+            typename Field::Element_ptr Acop = FFLAS::workspace_new(F,__FFLAS__Na,__FFLAS__Na,H.WS);
             typename Field::Element_ptr Acopi = Acop;
 #undef __FFLAS__Atrsm
 #undef __FFLAS__Atrsm_lda
@@ -309,7 +309,7 @@ public:
 #endif //__FFLAS__TRSM_READONLY
 
 #ifdef __FFLAS__TRSM_READONLY
-            FFLAS::fflas_delete(Acop);
+            FFLAS::workspace_delete(H.WS,Acop);
 #endif //__FFLAS__TRSM_READONLY
 #endif // __FFLAS__UNIT
         } else { // __FFLAS__Na <= nblas
@@ -322,15 +322,21 @@ public:
 
 
 #ifdef __FFLAS__RIGHT
-            fgemm (D, FflasNoTrans, Mjoin (Fflas, __FFLAS__TRANS),
-                   __FFLAS__Mb2, __FFLAS__Nb2, nsplit, D.mOne,
-                   __FFLAS__B1, ldb, __FFLAS__A2, lda,
-                   F.one, __FFLAS__B2, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (D, __FFLAS__Mb2, nsplit, __FFLAS__Nb2);
+                fgemm (D, FflasNoTrans, Mjoin (Fflas, __FFLAS__TRANS),
+                       __FFLAS__Mb2, __FFLAS__Nb2, nsplit, D.mOne,
+                       __FFLAS__B1, ldb, __FFLAS__A2, lda,
+                       F.one, __FFLAS__B2, ldb, HU);
+            }
 #else
-            fgemm (D, Mjoin (Fflas, __FFLAS__TRANS), FflasNoTrans,
-                   __FFLAS__Mb2, __FFLAS__Nb2, nsplit, D.mOne,
-                   __FFLAS__A2, lda, __FFLAS__B1, ldb,
-                   F.one, __FFLAS__B2, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (D, __FFLAS__Mb2, nsplit, __FFLAS__Nb2);
+                fgemm (D, Mjoin (Fflas, __FFLAS__TRANS), FflasNoTrans,
+                       __FFLAS__Mb2, __FFLAS__Nb2, nsplit, D.mOne,
+                       __FFLAS__A2, lda, __FFLAS__B1, ldb,
+                       F.one, __FFLAS__B2, ldb, HU);
+            }
 #endif //__FFLAS__RIGHT
 
             this->delayed (F, __FFLAS__Mb2, __FFLAS__Nb2,
@@ -359,6 +365,11 @@ public:
         __FFLAS__DOMAIN D(F);
         size_t nblas = TRSMBound<Field> (F);
         size_t ndel = DotProdBoundClassic (F, F.one);
+#ifndef __FFLAS_MULTIPRECISION
+        // a tuned cap on the triangular blocks, if any
+        if (tuning().FtrsmThreshold)
+            ndel = std::min (ndel, std::max (tuning().FtrsmThreshold, nblas));
+#endif
         ndel = (ndel / nblas)*nblas;
         size_t nsplit = ndel;
         size_t nbblocsplit = (__FFLAS__Na-1) / nsplit;
@@ -368,15 +379,21 @@ public:
                            __FFLAS__Atriang, lda, __FFLAS__Brec, ldb, nblas, nsplit / nblas, H);
 
 #ifdef __FFLAS__RIGHT
-            fgemm (F, FflasNoTrans, Mjoin (Fflas, __FFLAS__TRANS),
-                   __FFLAS__Mupdate, __FFLAS__Nupdate, nsplit, F.mOne,
-                   __FFLAS__Brec, ldb, __FFLAS__Aupdate, lda,
-                   F.one, __FFLAS__Bupdate, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (F, __FFLAS__Mupdate, nsplit, __FFLAS__Nupdate);
+                fgemm (F, FflasNoTrans, Mjoin (Fflas, __FFLAS__TRANS),
+                       __FFLAS__Mupdate, __FFLAS__Nupdate, nsplit, F.mOne,
+                       __FFLAS__Brec, ldb, __FFLAS__Aupdate, lda,
+                       F.one, __FFLAS__Bupdate, ldb, HU);
+            }
 #else
-            fgemm (F, Mjoin (Fflas, __FFLAS__TRANS),  FflasNoTrans,
-                   __FFLAS__Mupdate, __FFLAS__Nupdate, nsplit, F.mOne,
-                   __FFLAS__Aupdate, lda, __FFLAS__Brec, ldb,
-                   F.one, __FFLAS__Bupdate, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (F, __FFLAS__Mupdate, nsplit, __FFLAS__Nupdate);
+                fgemm (F, Mjoin (Fflas, __FFLAS__TRANS),  FflasNoTrans,
+                       __FFLAS__Mupdate, __FFLAS__Nupdate, nsplit, F.mOne,
+                       __FFLAS__Aupdate, lda, __FFLAS__Brec, ldb,
+                       F.one, __FFLAS__Bupdate, ldb, HU);
+            }
 #endif //__FFLAS__RIGHT
         }
         if (nrestsplit)
@@ -426,15 +443,21 @@ public:
             size_t nsplit = __FFLAS__Na >> 1;
             this->operator() (F, __FFLAS__Mb, __FFLAS__Nb, __FFLAS__A1, lda, __FFLAS__B1, ldb, H);
 #ifdef __FFLAS__RIGHT
-            fgemm (F, FflasNoTrans , Mjoin (Fflas, __FFLAS__TRANS),
-                   __FFLAS__Mb2, __FFLAS__Nb2, nsplit, F.mOne,
-                   __FFLAS__B1, ldb, __FFLAS__A2, lda,
-                   F.one, __FFLAS__B2, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (F, __FFLAS__Mb2, nsplit, __FFLAS__Nb2);
+                fgemm (F, FflasNoTrans , Mjoin (Fflas, __FFLAS__TRANS),
+                       __FFLAS__Mb2, __FFLAS__Nb2, nsplit, F.mOne,
+                       __FFLAS__B1, ldb, __FFLAS__A2, lda,
+                       F.one, __FFLAS__B2, ldb, HU);
+            }
 #else //__FFLAS__RIGHT
-            fgemm (F, Mjoin (Fflas, __FFLAS__TRANS), FFLAS::FflasNoTrans,
-                   __FFLAS__Mb2, __FFLAS__Nb2, nsplit, F.mOne,
-                   __FFLAS__A2, lda, __FFLAS__B1, ldb,
-                   F.one, __FFLAS__B2, ldb, H.parseq);
+            {
+                auto HU = H.updateMMH (F, __FFLAS__Mb2, nsplit, __FFLAS__Nb2);
+                fgemm (F, Mjoin (Fflas, __FFLAS__TRANS), FFLAS::FflasNoTrans,
+                       __FFLAS__Mb2, __FFLAS__Nb2, nsplit, F.mOne,
+                       __FFLAS__A2, lda, __FFLAS__B1, ldb,
+                       F.one, __FFLAS__B2, ldb, HU);
+            }
 #endif //__FFLAS__RIGHT
             this->operator() (F, __FFLAS__Mb2, __FFLAS__Nb2, __FFLAS__A3, lda, __FFLAS__B2, ldb, H);
         }
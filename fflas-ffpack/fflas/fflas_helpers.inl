@@ -34,6 +34,7 @@
 #include "fflas-ffpack/field/field-traits.h"
 #include "fflas-ffpack/paladin/parallel.h"
 #include "fflas-ffpack/utils/flimits.h"
+#include "fflas-ffpack/utils/fflas_workspace.h"
 
 #include <algorithm> // std::max
 
@@ -71,6 +72,13 @@ namespace FFLAS {
         inline bool unfit(RecInt::rint<K> x){return (x > RecInt::rint<K>(limits<RecInt::rint<K-1>>::max()));}
         template <>
         inline bool unfit(RecInt::rint<6> x){return (x > limits<int32_t>::max());}
+
+        /** The Workspace passed on to a helper copied from one running on \p parseq.
+         * The copies of a parallel helper run in concurrent tasks, which must not share the arena.
+         */
+        template <class ParSeqTrait>
+        inline Workspace* inherit_workspace(const ParSeqTrait&, Workspace*){return nullptr;}
+        inline Workspace* inherit_workspace(const ParSeqHelper::Sequential&, Workspace* W){return W;}
     }
 
     namespace MMHelperAlgo{
@@ -102,14 +110,16 @@ namespace FFLAS {
         typedef MMHelper<Field,AlgoTrait, ModeCategories::DefaultTag,ParSeqTrait> Self_t;
         int recLevel ;
         ParSeqTrait parseq;
+        size_t WorkspaceBudget;
+        Workspace* WS;
 
-        MMHelper(){}
-        MMHelper(const Field& F, size_t m, size_t k, size_t n, ParSeqTrait _PS) : recLevel(-1), parseq(_PS) {}
-        MMHelper(const Field& F, int w, ParSeqTrait _PS=ParSeqTrait()) : recLevel(w), parseq(_PS) {}
+        MMHelper() : WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
+        MMHelper(const Field& F, size_t m, size_t k, size_t n, ParSeqTrait _PS) : recLevel(-1), parseq(_PS), WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
+        MMHelper(const Field& F, int w, ParSeqTrait _PS=ParSeqTrait()) : recLevel(w), parseq(_PS), WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
 
         // copy constructor from other Field and Algo Traits
         template<class F2, typename AlgoT2, typename FT2, typename PS2>
-        MMHelper(MMHelper<F2, AlgoT2, FT2, PS2>& WH) : recLevel(WH.recLevel), parseq(WH.parseq) {}
+        MMHelper(MMHelper<F2, AlgoT2, FT2, PS2>& WH) : recLevel(WH.recLevel), parseq(WH.parseq), WorkspaceBudget(WH.WorkspaceBudget), WS(Protected::inherit_workspace(WH.parseq, WH.WS)) {}
 
         friend std::ostream& operator<<(std::ostream& out, const Self_t& M)
         {
@@ -129,14 +139,16 @@ namespace FFLAS {
         typedef MMHelper<Field,AlgoTrait, ModeCategories::ConvertTo<Dest>,ParSeqTrait> Self_t;
         int recLevel ;
         ParSeqTrait parseq;
+        size_t WorkspaceBudget;
+        Workspace* WS;
 
-        MMHelper(){}
-        MMHelper(const Field& F, size_t m, size_t k, size_t n, ParSeqTrait _PS) : recLevel(-1), parseq(_PS) {}
-        MMHelper(const Field& F, int w, ParSeqTrait _PS=ParSeqTrait()) : recLevel(w), parseq(_PS) {}
+        MMHelper() : WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
+        MMHelper(const Field& F, size_t m, size_t k, size_t n, ParSeqTrait _PS) : recLevel(-1), parseq(_PS), WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
+        MMHelper(const Field& F, int w, ParSeqTrait _PS=ParSeqTrait()) : recLevel(w), parseq(_PS), WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
 
         // copy constructor from other Field and Algo Traits
         template<class F2, typename AlgoT2, typename FT2, typename PS2>
-        MMHelper(MMHelper<F2, AlgoT2, FT2, PS2>& WH) : recLevel(WH.recLevel), parseq(WH.parseq) {}
+        MMHelper(MMHelper<F2, AlgoT2, FT2, PS2>& WH) : recLevel(WH.recLevel), parseq(WH.parseq), WorkspaceBudget(WH.WorkspaceBudget), WS(Protected::inherit_workspace(WH.parseq, WH.WS)) {}
 
         friend std::ostream& operator<<(std::ostream& out, const Self_t& M)
         {
@@ -163,6 +175,10 @@ namespace FFLAS {
 
         const DelayedField_t delayedField;
         ParSeqTrait parseq;
+        //! bytes of temporaries the Strassen-Winograd schedules may allocate, see WinogradParCalc
+        size_t WorkspaceBudget;
+        //! arena for these temporaries, if not null, see fflas_workspace.h
+        Workspace* WS;
         void initC(){Cmin = FieldMin; Cmax = FieldMax;}
         void initA(){Amin = FieldMin; Amax = FieldMax;}
         void initB(){Bmin = FieldMin; Bmax = FieldMax;}
@@ -281,7 +297,7 @@ namespace FFLAS {
             return true;
         }
 
-        MMHelper(){}
+        MMHelper() : WorkspaceBudget(std::numeric_limits<size_t>::max()), WS(nullptr) {}
         //TODO: delayedField constructor has a >0 characteristic even when it is a Double/FloatDomain
         // correct but semantically not satisfactory
         MMHelper(const Field& F, size_t m, size_t k, size_t n, ParSeqTrait _PS) :
@@ -294,7 +310,9 @@ namespace FFLAS {
             MaxStorableValue ((DFElt)(limits<typename DelayedField::Element>::max())),
             delayedField(F),
             // delayedField((typename Field::Element)F.characteristic()),
-            parseq(_PS)
+            parseq(_PS),
+            WorkspaceBudget(std::numeric_limits<size_t>::max()),
+            WS(nullptr)
         {
         }
 
@@ -307,7 +325,9 @@ namespace FFLAS {
             Outmin(0), Outmax(0),
             MaxStorableValue ((DFElt)(limits<typename DelayedField::Element>::max())),
             delayedField(F),
-            parseq(_PS)
+            parseq(_PS),
+            WorkspaceBudget(std::numeric_limits<size_t>::max()),
+            WS(nullptr)
         {
         }
 
@@ -322,7 +342,9 @@ namespace FFLAS {
             Outmin(WH.Outmin), Outmax(WH.Outmax),
             MaxStorableValue(WH.MaxStorableValue),
             delayedField(WH.delayedField),
-            parseq(WH.parseq)
+            parseq(WH.parseq),
+            WorkspaceBudget(WH.WorkspaceBudget),
+            WS(Protected::inherit_workspace(WH.parseq, WH.WS))
         {
         }
 
@@ -338,7 +360,9 @@ namespace FFLAS {
             Outmin(0),Outmax(0),
             MaxStorableValue(limits<typename DelayedField::Element>::max()),
             delayedField(F),
-            parseq(_PS)
+            parseq(_PS),
+            WorkspaceBudget(std::numeric_limits<size_t>::max()),
+            WS(nullptr)
         {
         }
 
@@ -388,15 +412,19 @@ namespace FFLAS {
     template<typename RecIterTrait = StructureHelper::Recursive, typename ParSeqTrait = ParSeqHelper::Sequential>
     struct TRSMHelper {
         ParSeqTrait parseq;
+        //! arena for the temporaries of ftrsm and of its fgemm updates, if not null
+        Workspace* WS;
         template<class Cut,class Param>
-        TRSMHelper(ParSeqHelper::Parallel<Cut,Param> _PS):parseq(_PS){}
-        TRSMHelper(ParSeqHelper::Sequential _PS):parseq(_PS){}
+        TRSMHelper(ParSeqHelper::Parallel<Cut,Param> _PS):parseq(_PS),WS(nullptr){}
+        TRSMHelper(ParSeqHelper::Sequential _PS, Workspace* W=nullptr):parseq(_PS),WS(W){}
         template<typename RIT, typename PST>
-        TRSMHelper(TRSMHelper<RIT,PST>& _TH):parseq(_TH.parseq){}
+        TRSMHelper(TRSMHelper<RIT,PST>& _TH):parseq(_TH.parseq),WS(Protected::inherit_workspace(_TH.parseq,_TH.WS)){}
 
         template<class Dom, class Algo=FFLAS::MMHelperAlgo::Winograd, class ModeT=typename FFLAS::ModeTraits<Dom>::value>
         FFLAS::MMHelper<Dom, Algo, ModeT, ParSeqTrait> pMMH (Dom& D, size_t m, size_t k, size_t n, ParSeqTrait p) const {
-            return FFLAS::MMHelper<Dom, Algo, ModeT, ParSeqTrait>(D,m,k,n,p);
+            FFLAS::MMHelper<Dom, Algo, ModeT, ParSeqTrait> H(D,m,k,n,p);
+            H.WS = Protected::inherit_workspace(parseq, WS);
+            return H;
         }
 
         template<class Dom, class Algo=FFLAS::MMHelperAlgo::Winograd, class ModeT=typename FFLAS::ModeTraits<Dom>::value>
@@ -404,6 +432,15 @@ namespace FFLAS {
             return pMMH(D,m,k,n,this->parseq);
         }
 
+        //! Helper of the fgemm updates of ftrsm over D, sharing its workspace
+        template<class Dom>
+        FFLAS::MMHelper<Dom, FFLAS::MMHelperAlgo::Auto, typename FFLAS::ModeTraits<Dom>::value, ParSeqTrait>
+        updateMMH (const Dom& D, size_t m, size_t k, size_t n) const {
+            FFLAS::MMHelper<Dom, FFLAS::MMHelperAlgo::Auto, typename FFLAS::ModeTraits<Dom>::value, ParSeqTrait> H(D,m,k,n,parseq);
+            H.WS = Protected::inherit_workspace(parseq, WS);
+            return H;
+        }
+
     };
 
 
@@ -42,6 +42,7 @@ namespace FFLAS {
 #include "igemm_kernels.h"
 #include "igemm_tools.h"
 #include "fflas-ffpack/utils/fflas_memory.h"
+#include "fflas-ffpack/utils/fflas_workspace.h"
 
 namespace FFLAS { namespace Protected {
 
@@ -71,6 +72,19 @@ namespace FFLAS { namespace Protected {
                       , int64_t* C, size_t ldc
                      ) ;
 
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128)
+    //! Maximal depth of igemm52, for which the 64-bit halves do not overflow
+    static const constexpr size_t igemm52_kmax = 4096;
+
+    //! the packed blocks are taken from W if not null
+    inline void igemm52(const enum FFLAS_TRANSPOSE TransA, const enum FFLAS_TRANSPOSE TransB
+                        , size_t rows, size_t cols, size_t depth
+                        , const uint64_t* A, size_t lda, const uint64_t* B, size_t ldb
+                        , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                        , Workspace* W = nullptr
+                       ) ;
+#endif
+
 } // Protected
 } // FFLAS
 
@@ -157,6 +157,85 @@ namespace FFLAS { namespace Protected {
         }
     }
 
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128)
+
+    // Lo + 2^52 Hi += A*B, in column major, for entries of A and B below 2^52
+    // and depth at most igemm52_kmax
+    template<enum FFLAS_TRANSPOSE tA, enum FFLAS_TRANSPOSE tB>
+    void igemm52_colmajor(size_t rows, size_t cols, size_t depth,
+                          const uint64_t* A, size_t lda, const uint64_t* B, size_t ldb,
+                          uint64_t* Lo, uint64_t* Hi, size_t ldl, Workspace* W)
+    {
+        using simd = Simd<int64_t> ;
+        FFLASFFPACK_check(depth <= igemm52_kmax);
+        size_t mc,kc,nc;
+        mc=rows;
+        nc=cols;
+        kc=depth;
+        FFLAS::details::BlockingFactor(mc,nc,kc);
+        size_t sizeA = mc*kc;
+        size_t sizeB = kc*cols;
+
+        // the packing routines work on int64_t, the entries are below 2^52
+        const int64_t* Ai = reinterpret_cast<const int64_t*>(A);
+        const int64_t* Bi = reinterpret_cast<const int64_t*>(B);
+        int64_t *blockA = workspace_new<int64_t>(sizeA, (Alignment)simd::alignment, W);
+        int64_t *blockB = workspace_new<int64_t>(sizeB, (Alignment)simd::alignment, W);
+
+        for(size_t k2=0; k2<depth; k2+=kc){
+
+            const size_t actual_kc = std::min(k2+kc,depth)-k2;
+
+            if (tB == FflasNoTrans)
+                FFLAS::details::pack_rhs<_nr,false>(blockB, Bi+k2, ldb, actual_kc, cols);
+            else
+                FFLAS::details::pack_lhs<_nr,true>(blockB, Bi+k2*ldb, ldb, cols, actual_kc);
+
+            for(size_t i2=0; i2<rows; i2+=mc){
+
+                const size_t actual_mc = std::min(i2+mc,rows)-i2;
+
+                if (tA == FflasNoTrans)
+                    FFLAS::details::pack_lhs<_mr,false>(blockA, Ai+i2+k2*lda, lda, actual_mc, actual_kc);
+                else
+                    FFLAS::details::pack_rhs<_mr,true>(blockA, Ai+i2*lda+k2, lda, actual_kc, actual_mc);
+
+                FFLAS::details::igebp52(actual_mc, cols, actual_kc
+                                        , reinterpret_cast<const uint64_t*>(blockA), actual_kc
+                                        , reinterpret_cast<const uint64_t*>(blockB), actual_kc
+                                        , Lo+i2, Hi+i2, ldl);
+            }
+        }
+
+        workspace_delete(W, blockB, blockA);
+    }
+
+    void igemm52( const enum FFLAS_TRANSPOSE TransA, const enum FFLAS_TRANSPOSE TransB,
+                  size_t rows, size_t cols, size_t depth
+                  , const uint64_t* A, size_t lda, const uint64_t* B, size_t ldb
+                  , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                  , Workspace* W
+                )
+    {
+        if (!rows || !cols || !depth) {
+            return ;
+        }
+        if (TransA == FflasNoTrans) {
+            if (TransB == FflasNoTrans)
+                igemm52_colmajor<FflasNoTrans,FflasNoTrans>(rows, cols, depth, A, lda, B, ldb, Lo, Hi, ldl, W);
+            else
+                igemm52_colmajor<FflasNoTrans,FflasTrans>(rows, cols, depth, A, lda, B, ldb, Lo, Hi, ldl, W);
+        }
+        else {
+            if (TransB == FflasNoTrans)
+                igemm52_colmajor<FflasTrans,FflasNoTrans>(rows, cols, depth, A, lda, B, ldb, Lo, Hi, ldl, W);
+            else
+                igemm52_colmajor<FflasTrans,FflasTrans>(rows, cols, depth, A, lda, B, ldb, Lo, Hi, ldl, W);
+        }
+    }
+
+#endif // AVX512IFMA and INT128
+
 } // Protected
 } // FFLAS
 
@@ -89,6 +89,30 @@ namespace FFLAS { namespace details {
                 const int64_t* blockB, size_t ldb,
                 int64_t* C, size_t ldc);
 
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128)
+
+    /* ****************************** */
+    /*  52-BIT MULTIPLY-ADD KERNELS   */
+    /* ****************************** */
+
+    template<size_t mr, size_t nr>
+    inline void igebb52(size_t i, size_t j, size_t depth
+                        , const uint64_t *blA, const uint64_t* blB
+                        , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                       );
+
+    inline void igebb52s(size_t i, size_t j, size_t depth, size_t nr
+                         , const uint64_t *blA, const uint64_t* blB
+                         , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                        );
+
+    inline void igebp52( size_t rows, size_t cols, size_t depth
+                         , const uint64_t* blockA, size_t lda,
+                         const uint64_t* blockB, size_t ldb,
+                         uint64_t* Lo, uint64_t* Hi, size_t ldl);
+
+#endif // AVX512IFMA and INT128
+
 } // details
 } // FFLAS
 
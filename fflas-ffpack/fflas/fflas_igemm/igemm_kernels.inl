@@ -659,6 +659,112 @@ namespace FFLAS { namespace details { /*  main */
 } // details
 } // FFLAS
 
+#if defined(__FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_INT128)
+
+/*****************************************************
+ *  GEBP WITH THE 52-BIT MULTIPLY-ADDS OF AVX512IFMA *
+ *****************************************************/
+
+namespace FFLAS { namespace details { /*  ifma */
+
+    // The product of two entries below 2^52 is split into its low and high
+    // 52 bits, accumulated in Lo and Hi: both stay below 2^64 for up to
+    // 2^12 products. Same packing and column major layout as igebp.
+    template<size_t mr, size_t nr>
+    inline void igebb52(size_t i, size_t j, size_t depth
+                        , const uint64_t *blA, const uint64_t* blB
+                        , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                       )
+    {
+        using simd = Simd512<uint64_t>;
+        using vect_t =  typename simd::vect_t;
+        static const constexpr size_t mv = mr/simd::vect_size;
+        static_assert(mv*simd::vect_size == mr, "mr must be a multiple of the simd size");
+        // mv*nr*2 accumulators, mv A vectors and 1 broadcast: at most 19 zmm registers
+        vect_t L[mv][nr], H[mv][nr], A[mv], B;
+        uint64_t *l0 = Lo+j*ldl+i;
+        uint64_t *h0 = Hi+j*ldl+i;
+        for (size_t c=0;c<nr;++c)
+            for (size_t v=0;v<mv;++v){
+                L[v][c] = simd::loadu(l0+c*ldl+v*simd::vect_size);
+                H[v][c] = simd::loadu(h0+c*ldl+v*simd::vect_size);
+            }
+        for (size_t k=0;k<depth;++k){
+            for (size_t v=0;v<mv;++v)
+                A[v] = simd::loadu(blA+k*mr+v*simd::vect_size);
+            for (size_t c=0;c<nr;++c){
+                B = simd::set1(blB[k*nr+c]);
+                for (size_t v=0;v<mv;++v){
+                    simd::madd52loin(L[v][c],A[v],B);
+                    simd::madd52hiin(H[v][c],A[v],B);
+                }
+            }
+        }
+        for (size_t c=0;c<nr;++c)
+            for (size_t v=0;v<mv;++v){
+                simd::storeu(l0+c*ldl+v*simd::vect_size,L[v][c]);
+                simd::storeu(h0+c*ldl+v*simd::vect_size,H[v][c]);
+            }
+    }
+
+    // one remaining row, against nr packed columns
+    inline void igebb52s(size_t i, size_t j, size_t depth, size_t nr
+                         , const uint64_t *blA, const uint64_t* blB
+                         , uint64_t* Lo, uint64_t* Hi, size_t ldl
+                        )
+    {
+        const uint64_t mask = (UINT64_C(1) << 52) - 1;
+        for (size_t c=0;c<nr;++c){
+            uint64_t lo = Lo[(j+c)*ldl+i], hi = Hi[(j+c)*ldl+i];
+            for (size_t k=0;k<depth;++k){
+                const uint128_t x = (uint128_t)blA[k] * blB[k*nr+c];
+                lo += (uint64_t)x & mask;
+                hi += (uint64_t)(x >> 52);
+            }
+            Lo[(j+c)*ldl+i] = lo;
+            Hi[(j+c)*ldl+i] = hi;
+        }
+    }
+
+    inline void igebp52( size_t rows, size_t cols, size_t depth
+                         , const uint64_t* blockA, size_t lda,
+                         const uint64_t* blockB, size_t ldb,
+                         uint64_t* Lo, uint64_t* Hi, size_t ldl)
+    {
+        using simd = Simd512<uint64_t>;
+        size_t i,j;
+        const size_t prows=(rows/_mr)*_mr;
+        const size_t pcols=(cols/_nr)*_nr;
+        // process columns by pack of _nr
+        for(j=0;j<pcols;j+=_nr){
+            for (i=0;i<prows;i+=_mr)
+                igebb52<_mr,_nr>(i, j, depth, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+            // the remaining rows are packed by one group of StepA, then one by one
+            if (rows-i >= simd::vect_size){
+                igebb52<simd::vect_size,_nr>(i, j, depth, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+                i+=simd::vect_size;
+            }
+            for (;i<rows;i++)
+                igebb52s(i, j, depth, _nr, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+        }
+        // process the (columns%_nr) remaining columns one by one
+        for (;j<cols;j++){
+            for (i=0;i<prows;i+=_mr)
+                igebb52<_mr,1>(i, j, depth, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+            if (rows-i >= simd::vect_size){
+                igebb52<simd::vect_size,1>(i, j, depth, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+                i+=simd::vect_size;
+            }
+            for (;i<rows;i++)
+                igebb52s(i, j, depth, 1, blockA+i*lda, blockB+j*ldb, Lo, Hi, ldl);
+        }
+    }
+
+} // details
+} // FFLAS
+
+#endif // AVX512IFMA and INT128
+
 #endif // __FFLASFFPACK_fflas_igemm_igemm_kernels_INL
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
 // vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
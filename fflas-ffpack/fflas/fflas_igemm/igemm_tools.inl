@@ -29,6 +29,7 @@
 #define __FFLASFFPACK_fflas_igemm_igemm_tools_INL
 
 #include "fflas-ffpack/fflas/fflas_simd.h"
+#include "fflas-ffpack/utils/fflas_tuning.h"
 
 namespace FFLAS { namespace details {
 
@@ -108,9 +109,8 @@ namespace FFLAS { namespace details {
 
     inline void BlockingFactor(size_t& m, size_t& n, size_t& k)
     {
-        int l1, l2, l3, tlb;
-        queryCacheSizes(l1,l2,l3);
-        getTLBSize(tlb);
+        const Tuning& T = tuning();
+        size_t l1 = T.L1, l2 = T.L2, l3 = T.L3, tlb = T.TLB;
         /*
            cout<<"Cache size: ";
            cout<<"L1 ("<<l1<<") ";
@@ -328,7 +328,7 @@ namespace FFLAS {
            typename Field::Element_ptr A, const size_t lda,
            typename Field::ConstElement_ptr D, const size_t incD,
            const typename Field::Element beta,
-           typename Field::Element_ptr C, const size_t ldc, const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+           typename Field::Element_ptr C, const size_t ldc, const size_t threshold=FFLAS::tuning().FsyrkThreshold);
     template<class Field>
     typename Field::Element_ptr
     fsyrk (const Field& F,
@@ -342,7 +342,7 @@ namespace FFLAS {
            const typename Field::Element beta,
            typename Field::Element_ptr C, const size_t ldc,
            const ParSeqHelper::Sequential seq,
-           const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+           const size_t threshold=FFLAS::tuning().FsyrkThreshold);
     template<class Field, class Cut, class Param>
     typename Field::Element_ptr
     fsyrk (const Field& F,
@@ -356,7 +356,7 @@ namespace FFLAS {
            const typename Field::Element beta,
            typename Field::Element_ptr C, const size_t ldc,
            const ParSeqHelper::Parallel<Cut,Param> par,
-           const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+           const size_t threshold=FFLAS::tuning().FsyrkThreshold);
     /** @brief  fsyrk: Symmetric Rank K update with diagonal scaling
      *
      * Computes the Lower or Upper triangular part of
@@ -395,7 +395,7 @@ namespace FFLAS {
            typename Field::ConstElement_ptr D, const size_t incD,
            const std::vector<bool>& twoBlock,
            const typename Field::Element beta,
-           typename Field::Element_ptr C, const size_t ldc, const size_t threshold=__FFLASFFPACK_FSYRK_THRESHOLD);
+           typename Field::Element_ptr C, const size_t ldc, const size_t threshold=FFLAS::tuning().FsyrkThreshold);
 
     /** @brief  fsyr2k: Symmetric Rank 2K update
      *
@@ -569,6 +569,99 @@ namespace FFLAS {
                     const typename Field::Element beta,
                     typename Field::Element_ptr C, const size_t ldc, size_t seuil, size_t *x);
 
+    /** @brief fgemm_batched: batch of independent products of equal dimensions.
+     *
+     * Computes \f$C_i = \alpha \mathrm{op}(A_i) \times \mathrm{op}(B_i) + \beta C_i\f$
+     * for \f$0 \leq i < \f$ \p batchcount, where the operands are given by arrays of pointers.
+     * Inputs are assumed reduced; the products may run in parallel if \p par is a ParSeqHelper::Parallel.
+     * \param F field.
+     * \param ta,tb,m,n,k,alpha,lda,ldb,beta,ldc as in fgemm, common to every product
+     * \param A,B,C arrays of \p batchcount pointers to the operands
+     * \param batchcount number of products
+     * \param par sequential or parallel helper
+     */
+    template<class Field, class ParSeqTrait>
+    void
+    fgemm_batched (const Field& F,
+                   const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                   const size_t m, const size_t n, const size_t k,
+                   const typename Field::Element alpha,
+                   typename Field::ConstElement_ptr const * A, const size_t lda,
+                   typename Field::ConstElement_ptr const * B, const size_t ldb,
+                   const typename Field::Element beta,
+                   typename Field::Element_ptr const * C, const size_t ldc,
+                   const size_t batchcount, const ParSeqTrait par);
+
+    /** @brief fgemm_strided_batched: batch of products whose operands are equally spaced in memory.
+     *
+     * Same as fgemm_batched with \f$A_i = A + i \cdot strideA\f$, and likewise for \p B and \p C.
+     */
+    template<class Field, class ParSeqTrait>
+    void
+    fgemm_strided_batched (const Field& F,
+                           const FFLAS_TRANSPOSE ta, const FFLAS_TRANSPOSE tb,
+                           const size_t m, const size_t n, const size_t k,
+                           const typename Field::Element alpha,
+                           typename Field::ConstElement_ptr A, const size_t lda, const size_t strideA,
+                           typename Field::ConstElement_ptr B, const size_t ldb, const size_t strideB,
+                           const typename Field::Element beta,
+                           typename Field::Element_ptr C, const size_t ldc, const size_t strideC,
+                           const size_t batchcount, const ParSeqTrait par);
+
+    template<class Field>
+    class PreparedMatrix;
+
+    /** @brief fgemm with a prepared left operand.
+     *
+     * Computes \f$C = \alpha A \times \mathrm{op}(B) + \beta C\f$, where \p A,
+     * of dimension \f$m \times k\f$, was prepared with side FflasLeft.
+     * \p B and \p C are assumed reduced.
+     */
+    template<class Field>
+    typename Field::Element_ptr
+    fgemm (const Field& F,
+           const FFLAS_TRANSPOSE tb,
+           const size_t n,
+           const typename Field::Element alpha,
+           const PreparedMatrix<Field>& A,
+           typename Field::ConstElement_ptr B, const size_t ldb,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc);
+
+    /** @brief fgemm with a prepared right operand.
+     *
+     * Computes \f$C = \alpha \mathrm{op}(A) \times B + \beta C\f$, where \p B,
+     * of dimension \f$k \times n\f$, was prepared with side FflasRight.
+     * \p A and \p C are assumed reduced.
+     */
+    template<class Field>
+    typename Field::Element_ptr
+    fgemm (const Field& F,
+           const FFLAS_TRANSPOSE ta,
+           const size_t m,
+           const typename Field::Element alpha,
+           typename Field::ConstElement_ptr A, const size_t lda,
+           const PreparedMatrix<Field>& B,
+           const typename Field::Element beta,
+           typename Field::Element_ptr C, const size_t ldc);
+
+    /** @brief fgemm_workspace: bytes of Workspace enough for fgemm.
+     *
+     * Returns the size of a Workspace which holds every temporary of an
+     * \f$m \times k\f$ by \f$k \times n\f$ fgemm run with the helper \p H
+     * (its algorithm, recursion level and number of threads), for any alpha and beta.
+     * Attached to \p H.WS, such a Workspace makes fgemm allocate nothing.
+     */
+    template<class Field, class AlgoT, class ModeT, class ParSeqTrait>
+    size_t
+    fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k,
+                     const MMHelper<Field, AlgoT, ModeT, ParSeqTrait>& H);
+
+    //! Same, for the default sequential helper
+    template<class Field>
+    size_t
+    fgemm_workspace (const Field& F, const size_t m, const size_t n, const size_t k);
+
     /** @brief  fgemm: <b>F</b>ield <b>GE</b>neral <b>M</b>atrix <b>M</b>ultiply.
      *
      * Computes \f$C = \alpha \mathrm{op}(A) \times \mathrm{op}(B) + \beta C\f$
@@ -71,6 +71,113 @@ namespace FFLAS {
                    );
         return B;
     }
+
+    /** \brief Parallel ftrsm cutting the triangular matrix.
+     *
+     * op(A) is cut into blocks of at least PTRSM_HYBRID_THRESHOLD rows (Left)
+     * or columns (Right). They are solved one after the other, each by the
+     * sequential recursive ftrsm, and every solve triggers the fgemm updates of
+     * the blocks of B after it as independent tasks. The update and the solve
+     * of the next block form a single task issued first, so that the next
+     * solve, on the critical path, overlaps the remaining updates. Unlike the
+     * Iterative variant, B is not cut along its other dimension, and this
+     * scales with few right hand sides.
+     */
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    ftrsm( const Field& F,
+           const FFLAS::FFLAS_SIDE Side,
+           const FFLAS::FFLAS_UPLO UpLo,
+           const FFLAS::FFLAS_TRANSPOSE TA,
+           const FFLAS::FFLAS_DIAG Diag,
+           const size_t m,
+           const size_t n,
+           const typename Field::Element alpha,
+#ifdef __FFLAS__TRSM_READONLY
+           typename Field::ConstElement_ptr
+#else
+           typename Field::Element_ptr
+#endif
+           A, const size_t lda,
+           typename Field::Element_ptr B, const size_t ldb,
+           TRSMHelper <StructureHelper::Recursive, ParSeqHelper::Parallel<Cut,Param> > & H)
+    {
+        typedef TRSMHelper<StructureHelper::Recursive,ParSeqHelper::Sequential> seqRecHelper;
+        typedef typename Field::Element_ptr Element_ptr;
+        if (!m || !n) return B;
+
+        const bool left = (Side == FflasLeft);
+        const size_t na = left ? m : n;
+        const size_t nt = H.parseq.numthreads();
+        // about two blocks per thread, to keep them busy while the block sizes shrink
+        const size_t nb = std::max ((size_t) PTRSM_HYBRID_THRESHOLD, (na + 2*nt - 1) / (2*nt));
+        const size_t nblocks = (na + nb - 1) / nb;
+        if (nt <= 1 || nblocks < 2) {
+            seqRecHelper SeqH (H);
+            ftrsm (F, Side, UpLo, TA, Diag, m, n, alpha, A, lda, B, ldb, SeqH);
+            return B;
+        }
+
+        // op(A) is lower triangular on the left or upper triangular on the right:
+        // the blocks are solved from the first one
+        const bool forward = (left == ((UpLo == FflasLower) == (TA == FflasNoTrans)));
+        auto bfirst = [=] (size_t k) -> size_t {
+            return (forward ? k : nblocks - 1 - k) * nb;
+        };
+        auto bsize = [=] (size_t k) -> size_t {
+            return std::min (nb, na - bfirst (k));
+        };
+        auto Bblock = [=] (size_t k) -> Element_ptr {
+            return left ? B + bfirst (k) * ldb : B + bfirst (k);
+        };
+        // B_i <- B_i - op(A)_{i,k} B_k on the left, B_i - B_k op(A)_{k,i} on the right
+        auto update = [=, &F] (size_t i, size_t k) {
+            const size_t fi = bfirst (i), fk = bfirst (k);
+            if (left)
+                fgemm (F, TA, FflasNoTrans, bsize (i), n, bsize (k), F.mOne,
+                       (TA == FflasNoTrans) ? A + fi*lda + fk : A + fk*lda + fi, lda,
+                       Bblock (k), ldb, F.one, Bblock (i), ldb, ParSeqHelper::Sequential());
+            else
+                fgemm (F, FflasNoTrans, TA, m, bsize (i), bsize (k), F.mOne,
+                       Bblock (k), ldb, (TA == FflasNoTrans) ? A + fk*lda + fi : A + fi*lda + fk, lda,
+                       F.one, Bblock (i), ldb, ParSeqHelper::Sequential());
+        };
+        auto solve = [=, &F, &H] (size_t k) {
+            seqRecHelper SeqH (H);
+            ftrsm (F, Side, UpLo, TA, Diag, left ? bsize (k) : m, left ? n : bsize (k), F.one,
+                   A + bfirst (k) * (lda + 1), lda, Bblock (k), ldb, SeqH);
+        };
+
+        SYNCH_GROUP(
+                    if (!F.isOne (alpha)) {
+                    for (size_t k = 0; k < nblocks; ++k) {
+                    Element_ptr Bk = Bblock (k);
+                    TASK(MODE(CONSTREFERENCE(F, alpha) READWRITE(Bk[0])),
+                         fscalin (F, left ? bsize (k) : m, left ? n : bsize (k), alpha, Bk, ldb));
+                    }
+                    CHECK_DEPENDENCIES;
+                    }
+                    {
+                    Element_ptr B0 = Bblock (0);
+                    TASK(MODE(CONSTREFERENCE(solve) READ(A[0]) READWRITE(B0[0])), solve (0));
+                    }
+                    CHECK_DEPENDENCIES;
+                    for (size_t k = 0; k + 1 < nblocks; ++k) {
+                    Element_ptr Bk = Bblock (k);
+                    Element_ptr Bn = Bblock (k+1);
+                    // lookahead: the next block is updated and solved first
+                    TASK(MODE(CONSTREFERENCE(update, solve) READ(Bk[0]) READWRITE(Bn[0])),
+                         update (k+1, k); solve (k+1));
+                    for (size_t i = k+2; i < nblocks; ++i) {
+                    Element_ptr Bi = Bblock (i);
+                    TASK(MODE(CONSTREFERENCE(update) READ(Bk[0]) READWRITE(Bi[0])), update (i, k));
+                    }
+                    CHECK_DEPENDENCIES;
+                    }
+                   );
+        return B;
+    }
+
     template<class Field, class Cut, class Param>
     inline typename Field::Element_ptr
     ftrsm( const Field& F,
@@ -481,6 +481,26 @@ template <> struct Simd256_impl<true, true, true, 2> : public Simd256i_base {
 
     static INLINE vect_t fnmaddxin(vect_t &c, const vect_t a, const vect_t b) { return c = fnmaddx(c, a, b); }
 
+    /*
+     * Multiply packed 16-bit integers in a and b, producing intermediate signed 32-bit integers,
+     * and add the adjacent pairs of them to the 32-bit integers of c (vpdpwssd with VNNI).
+     * Args   :	[a0, ..., a15]		int16_t
+     [b0, ..., b15]		int16_t
+     [c0, ..., c7]		int32_t
+     * Return :	[(a0*b0+a1*b1+c0) smod 2^32, ..., (a14*b14+a15*b15+c7) smod 2^32]	int32_t
+     */
+    static INLINE CONST vect_t dpwssd(const vect_t c, const vect_t a, const vect_t b) {
+#if defined(__FFLASFFPACK_HAVE_AVX512VNNI_INSTRUCTIONS) and defined(__FFLASFFPACK_HAVE_AVX512VL_INSTRUCTIONS)
+        return _mm256_dpwssd_epi32(c, a, b);
+#elif defined(__FFLASFFPACK_HAVE_AVXVNNI_INSTRUCTIONS)
+        return _mm256_dpwssd_avx_epi32(c, a, b);
+#else
+        return _mm256_add_epi32(c, _mm256_madd_epi16(a, b));
+#endif
+    }
+
+    static INLINE vect_t dpwssdin(vect_t &c, const vect_t a, const vect_t b) { return c = dpwssd(c, a, b); }
+
     /*
      * Multiply packed 16-bit integers in a and b, producing intermediate 32-bit integers,
      * and substract elements of c to the low 16-bits of the intermediate.
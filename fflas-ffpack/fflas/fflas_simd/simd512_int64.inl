@@ -810,6 +810,34 @@ template <> struct Simd512_impl<true, true, false, 8> : public Simd512_impl<true
         ca.v = a;
         return ca.t[0] + ca.t[1] + ca.t[2] + ca.t[3] + ca.t[4] + ca.t[5] + ca.t[6] + ca.t[7];
     }
+
+#ifdef __FFLASFFPACK_HAVE_AVX512IFMA_INSTRUCTIONS
+    /*
+     * Multiply the low 52 bits of the packed 64-bit unsigned integers in a and b, producing intermediate
+     104-bit integers, and add the low 52 bits of the intermediate to c.
+     * Args   : [a0, a1, a2, a3, a4, a5, a6, a7]	uint64_t
+     *	    	[b0, b1, b2, b3, b4, b5, b6, b7]	uint64_t
+     *	    	[c0, c1, c2, c3, c4, c5, c6, c7]	uint64_t
+     * Return : [c0 + (a0*b0 mod 2^52), ..., c7 + (a7*b7 mod 2^52)]	uint64_t
+     */
+    static INLINE CONST vect_t madd52lo(const vect_t c, const vect_t a, const vect_t b) {
+        return _mm512_madd52lo_epu64(c, a, b); }
+
+    static INLINE vect_t madd52loin(vect_t &c, const vect_t a, const vect_t b) { return c = madd52lo(c, a, b); }
+
+    /*
+     * Multiply the low 52 bits of the packed 64-bit unsigned integers in a and b, producing intermediate
+     104-bit integers, and add the high 52 bits of the intermediate to c.
+     * Args   : [a0, a1, a2, a3, a4, a5, a6, a7]	uint64_t
+     *	    	[b0, b1, b2, b3, b4, b5, b6, b7]	uint64_t
+     *	    	[c0, c1, c2, c3, c4, c5, c6, c7]	uint64_t
+     * Return : [c0 + Floor(a0*b0/2^52), ..., c7 + Floor(a7*b7/2^52)]	uint64_t
+     */
+    static INLINE CONST vect_t madd52hi(const vect_t c, const vect_t a, const vect_t b) {
+        return _mm512_madd52hi_epu64(c, a, b); }
+
+    static INLINE vect_t madd52hiin(vect_t &c, const vect_t a, const vect_t b) { return c = madd52hi(c, a, b); }
+#endif
 }; // Simd512_impl<true, true, false, 8>
 
 #define vect_t Simd512_impl<true, true, true, 8>::vect_t
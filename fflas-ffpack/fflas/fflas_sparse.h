@@ -114,7 +114,8 @@ namespace FFLAS {
         ELL_simd,
         ELL_simd_ZO,
         CSR_HYB,
-        HYB_ZO
+        HYB_ZO,
+        AUTO
     };
 
     template <class Field, SparseMatrix_t, class IdxT = index_t, class PtrT = index_t> struct Sparse;
@@ -129,6 +130,8 @@ namespace FFLAS {
 #include "fflas-ffpack/fflas/fflas_sparse/csr_hyb.h"
 #include "fflas-ffpack/fflas/fflas_sparse/ell_simd.h"
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo.h"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_auto.h"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_reorder.h"
 // #include "fflas-ffpack/fflas/fflas_sparse/sparse_matrix.h"
 
 namespace FFLAS {
@@ -388,11 +391,44 @@ namespace FFLAS {
     inline void pfspmm(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
                        const typename Field::Element &beta, typename Field::Element_ptr y, int ldy);
 #endif
+
+    /*********************************************************************************************************************
+     *
+     *    transposed SpMV, SpMM, pSpMV, pSpMM
+     *
+     *********************************************************************************************************************/
+
+    /** y <- A^T x + beta y, with x of size A.m and y of size A.n.
+     *
+     * Each row of A scatters into y: the parallel versions cut the rows (the
+     * entries for COO, the chunks for SELL) into NUM_THREADS blocks, each
+     * accumulating into its own copy of y, and then sum these copies by
+     * blocks of columns, so that no two threads ever update the same entry.
+     * For SELL, x is in the permuted row order of A, like the output of fspmv.
+     */
+    template <class Field, class SM>
+    inline void fspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                            const typename Field::Element &beta, typename Field::Element_ptr y);
+
+    /// y <- A^T x + beta y, with x of size A.m x blockSize and y of size A.n x blockSize
+    template <class Field, class SM>
+    inline void fspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                            const typename Field::Element &beta, typename Field::Element_ptr y, int ldy);
+
+    template <class Field, class SM>
+    inline void pfspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                             const typename Field::Element &beta, typename Field::Element_ptr y);
+
+    template <class Field, class SM>
+    inline void pfspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                             const typename Field::Element &beta, typename Field::Element_ptr y, int ldy);
 }
 
 #include "fflas-ffpack/fflas/fflas_sparse.inl"
 
 #include "fflas-ffpack/fflas/fflas_sparse/read_sparse.h"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_binary.h"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_ooc.h"
 
 
 namespace FFLAS {
@@ -53,9 +53,9 @@ namespace FFLAS {
                 if (F.isZero(b)) {
                     fzero(F, m, n, y, ldy);
                 } else if (F.isMOne(b)) {
-                    fnegin(F, m, n, y, 1);
+                    fnegin(F, m, n, y, ldy);
                 } else {
-                    fscalin(F, m, n, b, y, 1);
+                    fscalin(F, m, n, b, y, ldy);
                 }
             }
         }
@@ -382,6 +382,241 @@ namespace FFLAS {
             freduce(F, blockSize, A.m, y, ldy);
         }
 
+        /*************************************************************************************
+         *
+         *      transposed fspmv and fspmm dispatch
+         *
+         *************************************************************************************/
+
+        // y += A^T x over the units [iStart, iStop) of A, see sparse_details_impl::trans_units
+        template <class Field, class SM, class FCat>
+        inline void fspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                                typename Field::Element_ptr y, const uint64_t iStart, const uint64_t iStop,
+                                FCat, NotZOSparseMatrix) {
+            sparse_details_impl::fspmv_trans(F, A, x, y, iStart, iStop, FCat());
+        }
+
+        // x comes scaled by A.cst when it is neither 1 nor -1, see trans_scale
+        template <class Field, class SM, class FCat>
+        inline void fspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                                typename Field::Element_ptr y, const uint64_t iStart, const uint64_t iStop,
+                                FCat, ZOSparseMatrix) {
+            if (A.cst == -1 || F.isMOne(A.cst))
+                sparse_details_impl::fspmv_trans_mone(F, A, x, y, iStart, iStop, FCat());
+            else
+                sparse_details_impl::fspmv_trans_one(F, A, x, y, iStart, iStop, FCat());
+        }
+
+        template <class Field, class SM, class FCat>
+        inline void fspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                                typename Field::Element_ptr y, int ldy, const uint64_t iStart, const uint64_t iStop,
+                                FCat, NotZOSparseMatrix) {
+            sparse_details_impl::fspmm_trans(F, A, blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+        }
+
+        template <class Field, class SM, class FCat>
+        inline void fspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                                typename Field::Element_ptr y, int ldy, const uint64_t iStart, const uint64_t iStop,
+                                FCat, ZOSparseMatrix) {
+            if (A.cst == -1 || F.isMOne(A.cst))
+                sparse_details_impl::fspmm_trans_mone(F, A, blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+            else
+                sparse_details_impl::fspmm_trans_one(F, A, blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+        }
+
+        template <class Field, class SM>
+        inline typename Field::Element_ptr
+        trans_scale(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                    NotZOSparseMatrix) {
+            return nullptr;
+        }
+
+        // the m x blockSize matrix x scaled by the constant of a ZO matrix other than 1 and -1, nullptr otherwise
+        template <class Field, class SM>
+        inline typename Field::Element_ptr
+        trans_scale(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                    ZOSparseMatrix) {
+            if (A.cst == 1 || A.cst == -1 || F.isOne(A.cst) || F.isMOne(A.cst))
+                return nullptr;
+            typename Field::Element c;
+            F.init(c, A.cst);
+            auto x1 = fflas_new(F, A.m, blockSize, Alignment::CACHE_LINE);
+            fscal(F, A.m, blockSize, c, x, ldx, x1, blockSize);
+            return x1;
+        }
+
+        template <class Field>
+        inline void trans_addin(const Field &F, typename Field::Element &y, const typename Field::Element &z,
+                                FieldCategories::GenericTag) {
+            F.addin(y, z);
+        }
+
+        template <class Field>
+        inline void trans_addin(const Field &F, typename Field::Element &y, const typename Field::Element &z,
+                                FieldCategories::UnparametricTag) {
+            y += z;
+        }
+
+        /* y += A^T x with the units of A cut into nblocks: the rows of A scatter
+         * into all of y, so that each block accumulates into its own copy of y,
+         * the first one into y itself, and the copies are then summed into y by
+         * blocks of columns. It takes (nblocks-1) x n extra elements.
+         */
+        template <class Field, class SM, class FCat, class MZO>
+        inline void fspmv_trans_blocks(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                                       typename Field::Element_ptr y, const size_t nblocks, FCat, MZO) {
+            const uint64_t units = sparse_details_impl::trans_units(A);
+            const uint64_t n = A.n;
+            const size_t nb = (size_t) std::min((uint64_t)nblocks, units);
+            if (nb <= 1) {
+                sparse_details::fspmv_trans(F, A, x, y, 0, units, FCat(), MZO());
+                return;
+            }
+            typename Field::Element_ptr ys = fflas_new(F, (nb - 1) * n, Alignment::CACHE_LINE);
+            ParSeqHelper::Parallel<CuttingStrategy::Block, StrategyParameter::Threads> H(nb);
+            SYNCH_GROUP(
+                        FORBLOCK1D(iter, units, H,
+                                   TASK(MODE(CONSTREFERENCE(F, A)),
+                                        {
+                                        typename Field::Element_ptr yb = y;
+                                        if (iter.blockindex()) {
+                                        yb = ys + (iter.blockindex() - 1) * n;
+                                        fzero(F, n, yb, 1);
+                                        }
+                                        sparse_details::fspmv_trans(F, A, x, yb, iter.begin(), iter.end(), FCat(), MZO());
+                                        }); // TASK
+                                  ); // FORBLOCK1D
+                       );
+            SYNCH_GROUP(
+                        FORBLOCK1D(iter, n, H,
+                                   TASK(MODE(CONSTREFERENCE(F)),
+                                        {
+                                        for (uint64_t b = 0; b < nb - 1; ++b)
+                                        for (uint64_t j = iter.begin(); j < iter.end(); ++j)
+                                        trans_addin(F, y[j], ys[b * n + j], FCat());
+                                        }); // TASK
+                                  ); // FORBLOCK1D
+                       );
+            fflas_delete(ys);
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline void fspmm_trans_blocks(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x,
+                                       int ldx, typename Field::Element_ptr y, int ldy, const size_t nblocks, FCat, MZO) {
+            const uint64_t units = sparse_details_impl::trans_units(A);
+            const uint64_t n = A.n;
+            const size_t nb = (size_t) std::min((uint64_t)nblocks, units);
+            if (nb <= 1) {
+                sparse_details::fspmm_trans(F, A, blockSize, x, ldx, y, ldy, 0, units, FCat(), MZO());
+                return;
+            }
+            typename Field::Element_ptr ys = fflas_new(F, (nb - 1) * n, blockSize, Alignment::CACHE_LINE);
+            ParSeqHelper::Parallel<CuttingStrategy::Block, StrategyParameter::Threads> H(nb);
+            SYNCH_GROUP(
+                        FORBLOCK1D(iter, units, H,
+                                   TASK(MODE(CONSTREFERENCE(F, A)),
+                                        {
+                                        if (iter.blockindex()) {
+                                        typename Field::Element_ptr yb = ys + (iter.blockindex() - 1) * n * blockSize;
+                                        fzero(F, n, blockSize, yb, blockSize);
+                                        sparse_details::fspmm_trans(F, A, blockSize, x, ldx, yb, (int)blockSize,
+                                                                    iter.begin(), iter.end(), FCat(), MZO());
+                                        } else
+                                        sparse_details::fspmm_trans(F, A, blockSize, x, ldx, y, ldy,
+                                                                    iter.begin(), iter.end(), FCat(), MZO());
+                                        }); // TASK
+                                  ); // FORBLOCK1D
+                       );
+            SYNCH_GROUP(
+                        FORBLOCK1D(iter, n, H,
+                                   TASK(MODE(CONSTREFERENCE(F)),
+                                        {
+                                        for (uint64_t b = 0; b < nb - 1; ++b)
+                                        for (uint64_t j = iter.begin(); j < iter.end(); ++j)
+                                        for (size_t k = 0; k < blockSize; ++k)
+                                        trans_addin(F, y[j * ldy + k], ys[(b * n + j) * blockSize + k], FCat());
+                                        }); // TASK
+                                  ); // FORBLOCK1D
+                       );
+            fflas_delete(ys);
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline void fspmv_trans_cat(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                                    typename Field::Element_ptr y, const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmv_trans_blocks(F, A, x, y, nblocks, FCat(), MZO());
+        }
+
+        // delayed reduction when no column of A holds more than kmax elements
+        template <class Field, class SM, class MZO>
+        inline void fspmv_trans_cat(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                                    typename Field::Element_ptr y, const size_t nblocks, FieldCategories::ModularTag, MZO) {
+            if (A.kmax > A.maxcol) {
+                sparse_details::fspmv_trans_blocks(F, A, x, y, nblocks, FieldCategories::UnparametricTag(), MZO());
+                freduce(F, A.n, y, 1);
+            } else {
+                sparse_details::fspmv_trans_blocks(F, A, x, y, nblocks, FieldCategories::GenericTag(), MZO());
+            }
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline void fspmm_trans_cat(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x,
+                                    int ldx, typename Field::Element_ptr y, int ldy, const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmm_trans_blocks(F, A, blockSize, x, ldx, y, ldy, nblocks, FCat(), MZO());
+        }
+
+        template <class Field, class SM, class MZO>
+        inline void fspmm_trans_cat(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x,
+                                    int ldx, typename Field::Element_ptr y, int ldy, const size_t nblocks,
+                                    FieldCategories::ModularTag, MZO) {
+            if (A.kmax > A.maxcol) {
+                sparse_details::fspmm_trans_blocks(F, A, blockSize, x, ldx, y, ldy, nblocks,
+                                                   FieldCategories::UnparametricTag(), MZO());
+                freduce(F, A.n, blockSize, y, ldy);
+            } else {
+                sparse_details::fspmm_trans_blocks(F, A, blockSize, x, ldx, y, ldy, nblocks,
+                                                   FieldCategories::GenericTag(), MZO());
+            }
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline typename std::enable_if<
+        !(std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineFloatTag>::value ||
+          std::is_same<typename ElementTraits<typename Field::Element>::value,
+          ElementCategories::MachineIntTag>::value)>::type
+        fspmv_trans_dispatch(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
+                             const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmv_trans_blocks(F, A, x, y, nblocks, FieldCategories::GenericTag(), MZO());
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline typename std::enable_if<
+        std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineFloatTag>::value ||
+        std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineIntTag>::value>::type
+        fspmv_trans_dispatch(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
+                             const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmv_trans_cat(F, A, x, y, nblocks, FCat(), MZO());
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline typename std::enable_if<
+        !(std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineFloatTag>::value ||
+          std::is_same<typename ElementTraits<typename Field::Element>::value,
+          ElementCategories::MachineIntTag>::value)>::type
+        fspmm_trans_dispatch(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                             typename Field::Element_ptr y, int ldy, const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmm_trans_blocks(F, A, blockSize, x, ldx, y, ldy, nblocks, FieldCategories::GenericTag(), MZO());
+        }
+
+        template <class Field, class SM, class FCat, class MZO>
+        inline typename std::enable_if<
+        std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineFloatTag>::value ||
+        std::is_same<typename ElementTraits<typename Field::Element>::value, ElementCategories::MachineIntTag>::value>::type
+        fspmm_trans_dispatch(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                             typename Field::Element_ptr y, int ldy, const size_t nblocks, FCat, MZO) {
+            sparse_details::fspmm_trans_cat(F, A, blockSize, x, ldx, y, ldy, nblocks, FCat(), MZO());
+        }
+
 #if defined(__FFLASFFPACK_USE_OPENMP)
 
         /*************************************************************************************
@@ -573,22 +808,22 @@ namespace FFLAS {
             sparse_details_impl::pfspmv(F, A, x, y, tag);
         }
 
-        // template <class Field, class SM>
-        // inline void pfspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
-        //                    FieldCategories::UnparametricTag, std::false_type) {
-        //     sparse_details_impl::pfspmv(F, A, x, y, FieldCategories::UnparametricTag());
-        // }
+        template <class Field, class SM>
+        inline void pfspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
+                           FieldCategories::UnparametricTag, std::false_type) {
+            sparse_details_impl::pfspmv(F, A, x, y, FieldCategories::UnparametricTag());
+        }
 
-        // template <class Field, class SM>
-        // inline void pfspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
-        //                    FieldCategories::ModularTag, std::false_type) {
-        //     if (A.delayed) {
-        //         sparse_details::pfspmv(F, A, x, y, FieldCategories::UnparametricTag(), std::false_type());
-        //         freduce(F, A.m, y, 1);
-        //     } else {
-        //         sparse_details_impl::pfspmv(F, A, x, y, A.kmax);
-        //     }
-        // }
+        template <class Field, class SM>
+        inline void pfspmv(const Field &F, const SM &A, typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
+                           FieldCategories::ModularTag, std::false_type) {
+            if (A.delayed) {
+                sparse_details::pfspmv(F, A, x, y, FieldCategories::UnparametricTag(), std::false_type());
+                freduce(F, A.m, y, 1);
+            } else {
+                sparse_details_impl::pfspmv(F, A, x, y, A.kmax);
+            }
+        }
 
         // // ZO matrix
         // template <class Field, class SM>
@@ -874,6 +1109,58 @@ namespace FFLAS {
 
 #endif // __FFLASFFPACK_USE_OPENMP
 
+    template <class Field, class SM>
+    inline void fspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                            const typename Field::Element &beta, typename Field::Element_ptr y) {
+        sparse_details::init_y(F, A.n, beta, y);
+        typename Field::Element_ptr xs = sparse_details::trans_scale(F, A, 1, x, 1, typename isZOSparseMatrix<Field, SM>::type());
+        sparse_details::fspmv_trans_dispatch(F, A, xs ? xs : x, y, 1, typename FieldTraits<Field>::category(),
+                                             typename isZOSparseMatrix<Field, SM>::type());
+        if (xs)
+            fflas_delete(xs);
+    }
+
+    template <class Field, class SM>
+    inline void fspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                            const typename Field::Element &beta, typename Field::Element_ptr y, int ldy) {
+        sparse_details::init_y(F, A.n, blockSize, beta, y, ldy);
+        typename Field::Element_ptr xs = sparse_details::trans_scale(F, A, blockSize, x, ldx,
+                                                                     typename isZOSparseMatrix<Field, SM>::type());
+        sparse_details::fspmm_trans_dispatch(F, A, blockSize, xs ? xs : x, xs ? (int)blockSize : ldx, y, ldy, 1,
+                                             typename FieldTraits<Field>::category(),
+                                             typename isZOSparseMatrix<Field, SM>::type());
+        if (xs)
+            fflas_delete(xs);
+    }
+
+    template <class Field, class SM>
+    inline void pfspmv_trans(const Field &F, const SM &A, typename Field::ConstElement_ptr x,
+                             const typename Field::Element &beta, typename Field::Element_ptr y) {
+        sparse_details::init_y(F, A.n, beta, y);
+        typename Field::Element_ptr xs = sparse_details::trans_scale(F, A, 1, x, 1, typename isZOSparseMatrix<Field, SM>::type());
+        PAR_BLOCK{
+            sparse_details::fspmv_trans_dispatch(F, A, xs ? xs : x, y, NUM_THREADS, typename FieldTraits<Field>::category(),
+                                                 typename isZOSparseMatrix<Field, SM>::type());
+        }
+        if (xs)
+            fflas_delete(xs);
+    }
+
+    template <class Field, class SM>
+    inline void pfspmm_trans(const Field &F, const SM &A, size_t blockSize, typename Field::ConstElement_ptr x, int ldx,
+                             const typename Field::Element &beta, typename Field::Element_ptr y, int ldy) {
+        sparse_details::init_y(F, A.n, blockSize, beta, y, ldy);
+        typename Field::Element_ptr xs = sparse_details::trans_scale(F, A, blockSize, x, ldx,
+                                                                     typename isZOSparseMatrix<Field, SM>::type());
+        PAR_BLOCK{
+            sparse_details::fspmm_trans_dispatch(F, A, blockSize, xs ? xs : x, xs ? (int)blockSize : ldx, y, ldy, NUM_THREADS,
+                                                 typename FieldTraits<Field>::category(),
+                                                 typename isZOSparseMatrix<Field, SM>::type());
+        }
+        if (xs)
+            fflas_delete(xs);
+    }
+
     // template <class Field, class SM>
     // inline void pfspmm(const Field &F, const SM &A, size_t blockSize,
     //                    typename Field::ConstElement_ptr x, int ldx,
@@ -45,6 +45,7 @@ namespace FFLAS { /*  COO */
         uint64_t nnz = 0;
         uint64_t nElements = 0;
         uint64_t maxrow = 0;
+        uint64_t maxcol = 0;
     };
 
     template <class _Field>
@@ -77,6 +78,7 @@ namespace FFLAS { /*  COO */
 #include "fflas-ffpack/fflas/fflas_sparse/coo/coo_utils.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/coo/coo_spmv.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/coo/coo_spmm.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/coo/coo_trans.inl"
 
 #endif // __FFLASFFPACK_fflas_sparse_coo_H
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
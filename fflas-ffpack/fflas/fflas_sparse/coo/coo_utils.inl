@@ -52,6 +52,7 @@ namespace FFLAS {
         for (uint64_t i = 0; i < A.nnz; ++i)
             rows[row[i]]++;
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
         if (A.kmax > A.maxrow)
             A.delayed = true;
         A.col = fflas_new<index_t>(nnz, Alignment::CACHE_LINE);
@@ -77,6 +78,7 @@ namespace FFLAS {
         for (uint64_t i = 0; i < A.nnz; ++i)
             rows[row[i]]++;
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
         if (A.kmax > A.maxrow)
             A.delayed = true;
 
@@ -42,6 +42,7 @@ namespace FFLAS { /*  CSR */
         uint64_t nnz = 0;
         uint64_t nElements = 0;
         uint64_t maxrow = 0;
+        uint64_t maxcol = 0;
         index_t *col = nullptr;
         index_t *st = nullptr;
         index_t *stend = nullptr;
@@ -80,6 +81,7 @@ namespace FFLAS { /*  CSR */
 #include "fflas-ffpack/fflas/fflas_sparse/csr/csr_utils.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/csr/csr_spmv.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/csr/csr_spmm.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/csr/csr_trans.inl"
 
 #if defined(__FFLASFFPACK_USE_OPENMP) || defined(__FFLASFFPACK_USE_TBB)
 
@@ -42,7 +42,7 @@ namespace FFLAS {
             size_t m = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(CONSTREFERENCE(F) MODE(READ(dat, col, st, x) READWRITE(y)),
+                                   TASK(CONSTREFERENCE(F) MODE(READ(dat, col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -75,7 +75,7 @@ namespace FFLAS {
             size_t m = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -127,7 +127,7 @@ namespace FFLAS {
             vect_t y1, x1, y2, x2, vdat;
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -206,7 +206,7 @@ namespace FFLAS {
 
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(dat, col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -486,7 +486,7 @@ namespace FFLAS {
             SYNCH_GROUP(
                         FORBLOCK1D(it, am,
                                    SPLITTER(NUM_THREADS),
-                                   TASK(MODE(CONSTREFERENCE(F) READ(/*dat,*/ col, st, x) READWRITE(y)),
+                                   TASK(MODE(CONSTREFERENCE(F) READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         auto start = st[i];
                                         auto stop = st[i + 1];
@@ -523,7 +523,7 @@ namespace FFLAS {
             SYNCH_GROUP(
                         FORBLOCK1D(it, am,
                                    SPLITTER(NUM_THREADS),
-                                   TASK(MODE(CONSTREFERENCE(F) READ(/*dat,*/ col, st, x) READWRITE(y)),
+                                   TASK(MODE(CONSTREFERENCE(F) READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         auto start = st[i];
                                         auto stop = st[i + 1];
@@ -557,7 +557,7 @@ namespace FFLAS {
             size_t m = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -606,7 +606,7 @@ namespace FFLAS {
             size_t m = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -661,7 +661,7 @@ namespace FFLAS {
 
             SYNCH_GROUP(
                         FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                                   TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                         {
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -732,7 +732,7 @@ inline void pfspmm_one_simd_unaligned(const Field &F, const Sparse<Field, Sparse
     size_t m = A.m;
     SYNCH_GROUP(
                 FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                 {
                                 for (index_t i = it.begin(); i < it.end(); ++i) {
                                 for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -802,7 +802,7 @@ inline void pfspmm_mone_simd_aligned(const Field &F, const Sparse<Field, SparseM
 
     SYNCH_GROUP(
                 FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                 {
                                 for (index_t i = it.begin(); i < it.end(); ++i) {
                                 for (index_t j = st[i]; j < st[i + 1]; ++j) {
@@ -874,7 +874,7 @@ inline void pfspmm_mone_simd_unaligned(const Field &F, const Sparse<Field, Spars
 
     SYNCH_GROUP(
                 FORBLOCK1D(it, m, SPLITTER(NUM_THREADS),
-                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y)),
+                           TASK(MODE(READ(/*dat,*/ col, st, x) READWRITE(y[it.begin() * ldy])),
                                 {
                                 for (index_t i = it.begin(); i < it.end(); ++i) {
                                 for (index_t j = st[i]; j < st[i + 1]; ++j) {
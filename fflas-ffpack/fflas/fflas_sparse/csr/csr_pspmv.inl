@@ -158,24 +158,23 @@ namespace FFLAS {
                               }
                               });
 #else
-            // #pragma omp parallel for schedule(static, 8)
-            //     for (index_t i = 0; i < A.m; ++i) {
-            //         auto start = st[i], stop = st[i + 1];
-            //         index_t j = 0;
-            //         index_t diff = stop - start;
-            //         typename Field::Element y1 = 0, y2 = 0, y3 = 0, y4 = 0;
-            //         for (; j < ROUND_DOWN(diff, 4); j += 4) {
-            //             y1 += dat[start + j] * x[col[start + j]];
-            //             y2 += dat[start + j + 1] * x[col[start + j + 1]];
-            //             y3 += dat[start + j + 2] * x[col[start + j + 2]];
-            //             y4 += dat[start + j + 3] * x[col[start + j + 3]];
-            //         }
-            //         for (; j < diff; ++j) {
-            //             y1 += dat[start + j] * x[col[start + j]];
-            //         }
-            //         y[i] += y1 + y2 + y3 + y4;
-            //     }
-            std::vector<std::thread> pool(6);
+#pragma omp parallel for schedule(static, 8)
+            for (index_t i = 0; i < A.m; ++i) {
+                auto start = st[i], stop = st[i + 1];
+                index_t j = 0;
+                index_t diff = stop - start;
+                typename Field::Element y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+                for (; j < ROUND_DOWN(diff, 4); j += 4) {
+                    y1 += dat[start + j] * x[col[start + j]];
+                    y2 += dat[start + j + 1] * x[col[start + j + 1]];
+                    y3 += dat[start + j + 2] * x[col[start + j + 2]];
+                    y4 += dat[start + j + 3] * x[col[start + j + 3]];
+                }
+                for (; j < diff; ++j) {
+                    y1 += dat[start + j] * x[col[start + j]];
+                }
+                y[i] += y1 + y2 + y3 + y4;
+            }
 
 #endif
         }
@@ -243,7 +242,7 @@ namespace FFLAS {
             size_t am = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, am, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(CONSTREFERENCE(F) READ(col, st, x) READWRITE(y)),
+                                   TASK(MODE(CONSTREFERENCE(F) READ(col, st, x) READWRITE(y[it.begin()])),
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         auto start = st[i];
                                         auto stop = st[i + 1];
@@ -287,7 +286,7 @@ namespace FFLAS {
             size_t am = A.m;
             SYNCH_GROUP(
                         FORBLOCK1D(it, am, SPLITTER(NUM_THREADS),
-                                   TASK(MODE(CONSTREFERENCE(F) READ(col, st, x) READWRITE(y)),
+                                   TASK(MODE(CONSTREFERENCE(F) READ(col, st, x) READWRITE(y[it.begin()])),
                                         for (index_t i = it.begin(); i < it.end(); ++i) {
                                         auto start = st[i];
                                         auto stop = st[i + 1];
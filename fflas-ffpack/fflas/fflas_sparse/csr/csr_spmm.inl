@@ -121,6 +121,40 @@ namespace FFLAS {
 
 
 
+        template <class Field>
+        inline void fspmm_one(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_ZO> &A, size_t blockSize,
+                              typename Field::ConstElement_ptr x_, int ldx, typename Field::Element_ptr y_, int ldy,
+                              FieldCategories::UnparametricTag) {
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (index_t i = 0; i < A.m; ++i) {
+                auto start = st[i], stop = st[i + 1];
+                for (index_t j = start; j < stop; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        y[i * ldy + k] += x[col[j] * ldx + k];
+                }
+            }
+        }
+
+        template <class Field>
+        inline void fspmm_mone(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_ZO> &A, size_t blockSize,
+                               typename Field::ConstElement_ptr x_, int ldx, typename Field::Element_ptr y_, int ldy,
+                               FieldCategories::UnparametricTag) {
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (index_t i = 0; i < A.m; ++i) {
+                auto start = st[i], stop = st[i + 1];
+                for (index_t j = start; j < stop; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        y[i * ldy + k] -= x[col[j] * ldx + k];
+                }
+            }
+        }
+
         // #ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
 
         template <class Field>
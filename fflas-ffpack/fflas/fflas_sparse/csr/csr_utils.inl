@@ -30,6 +30,7 @@ namespace FFLAS {
         fflas_delete(A.dat);
         fflas_delete(A.col);
         fflas_delete(A.st);
+        fflas_delete(A.stend);
     }
 
     template <class Field> inline void sparse_delete(const Sparse<Field, SparseMatrix_t::CSR_ZO> &A) {
@@ -197,6 +198,7 @@ namespace FFLAS {
             rows[row[i]]++;
 
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
 
         if (A.kmax > A.maxrow)
             A.delayed = true;
@@ -223,6 +225,7 @@ namespace FFLAS {
     inline void sparse_init(const Field &F, Sparse<Field, SparseMatrix_t::CSR_ZO> &A, const IndexT *row, const IndexT *col,
                             typename Field::ConstElement_ptr dat, uint64_t rowdim, uint64_t coldim, uint64_t nnz) {
         A.delayed = true;
+        A.kmax = Protected::DotProdBoundClassic(F, F.one);
         A.m = rowdim;
         A.n = coldim;
         A.nnz = nnz;
@@ -231,6 +234,7 @@ namespace FFLAS {
         for (uint64_t i = 0; i < A.nnz; ++i)
             rows[row[i]]++;
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
         A.col = fflas_new<index_t>(nnz, Alignment::CACHE_LINE);
         A.st = fflas_new<index_t>(rowdim + 1, Alignment::CACHE_LINE);
         for (size_t i = 0; i < nnz; ++i) {
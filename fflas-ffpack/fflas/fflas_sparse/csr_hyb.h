@@ -45,6 +45,7 @@ namespace FFLAS { /*  CSR_HYB */
         uint64_t nnz = 0;
         uint64_t nElements = 0;
         uint64_t maxrow = 0;
+        uint64_t maxcol = 0;
         uint64_t nOnes = 0;
         uint64_t nMOnes = 0;
         uint64_t nOthers = 0;
@@ -66,7 +67,10 @@ namespace FFLAS { /*  CSR_HYB */
 #include "fflas-ffpack/fflas/fflas_sparse/csr_hyb/csr_hyb_pspmv.inl"
 #endif
 #include "fflas-ffpack/fflas/fflas_sparse/csr_hyb/csr_hyb_spmm.inl"
-// #include "fflas-ffpack/fflas/fflas_sparse/csr_hyb/csr_hyb_pspmm.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/csr_hyb/csr_hyb_trans.inl"
+#if defined(__FFLASFFPACK_USE_OPENMP)
+#include "fflas-ffpack/fflas/fflas_sparse/csr_hyb/csr_hyb_pspmm.inl"
+#endif
 
 #endif // __FFLASFFPACK_fflas_sparse_CSR_HYB_H
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
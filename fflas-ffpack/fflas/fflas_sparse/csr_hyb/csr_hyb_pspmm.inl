@@ -65,13 +65,13 @@ namespace FFLAS {
                               for (uint64_t j = start; j < stop; ++j) {
                                   size_t k = 0;
                                   for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                                      F.axpyin(y[i * blockSize + k], A.dat[startDat + k], x[A.col[j] * blockSize + k]);
-                                      F.axpyin(y[i * blockSize + k + 1], A.dat[startDat + k], x[A.col[j] * blockSize + k + 1]);
-                                      F.axpyin(y[i * blockSize + k + 2], A.dat[startDat + k], x[A.col[j] * blockSize + k + 2]);
-                                      F.axpyin(y[i * blockSize + k + 3], A.dat[startDat + k], x[A.col[j] * blockSize + k + 3]);
+                                      F.axpyin(y[i * blockSize + k], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k]);
+                                      F.axpyin(y[i * blockSize + k + 1], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 1]);
+                                      F.axpyin(y[i * blockSize + k + 2], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 2]);
+                                      F.axpyin(y[i * blockSize + k + 3], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 3]);
                                   }
                                   for (; k < blockSize; ++k)
-                                      F.axpyin(y[i * blockSize + k], A.dat[startDat + k], x[A.col[j] * blockSize + k]);
+                                      F.axpyin(y[i * blockSize + k], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k]);
                               }
                               }
                               });
@@ -107,13 +107,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        F.axpyin(y[i * blockSize + k], A.dat[startDat + k], x[A.col[j] * blockSize + k]);
-                        F.axpyin(y[i * blockSize + k + 1], A.dat[startDat + k], x[A.col[j] * blockSize + k + 1]);
-                        F.axpyin(y[i * blockSize + k + 2], A.dat[startDat + k], x[A.col[j] * blockSize + k + 2]);
-                        F.axpyin(y[i * blockSize + k + 3], A.dat[startDat + k], x[A.col[j] * blockSize + k + 3]);
+                        F.axpyin(y[i * blockSize + k], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k]);
+                        F.axpyin(y[i * blockSize + k + 1], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 1]);
+                        F.axpyin(y[i * blockSize + k + 2], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 2]);
+                        F.axpyin(y[i * blockSize + k + 3], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k + 3]);
                     }
                     for (; k < blockSize; ++k)
-                        F.axpyin(y[i * blockSize + k], A.dat[startDat + k], x[A.col[j] * blockSize + k]);
+                        F.axpyin(y[i * blockSize + k], A.dat[startDat + (j - start)], x[A.col[j] * blockSize + k]);
                 }
             }
 #endif
@@ -156,13 +156,13 @@ namespace FFLAS {
                               for (uint64_t j = start; j < stop; ++j) {
                                   size_t k = 0;
                                   for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                                      F.axpyin(y[i * ldy + k], A.dat[startDat + k], x[A.col[j] * ldx + k]);
-                                      F.axpyin(y[i * ldy + k + 1], A.dat[startDat + k], x[A.col[j] * ldx + k + 1]);
-                                      F.axpyin(y[i * ldy + k + 2], A.dat[startDat + k], x[A.col[j] * ldx + k + 2]);
-                                      F.axpyin(y[i * ldy + k + 3], A.dat[startDat + k], x[A.col[j] * ldx + k + 3]);
+                                      F.axpyin(y[i * ldy + k], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k]);
+                                      F.axpyin(y[i * ldy + k + 1], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 1]);
+                                      F.axpyin(y[i * ldy + k + 2], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 2]);
+                                      F.axpyin(y[i * ldy + k + 3], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 3]);
                                   }
                                   for (; k < blockSize; ++k)
-                                      F.axpyin(y[i * ldy + k], A.dat[startDat + k], x[A.col[j] * ldx + k]);
+                                      F.axpyin(y[i * ldy + k], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k]);
                               }
                               }
                               });
@@ -198,13 +198,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        F.axpyin(y[i * ldy + k], A.dat[startDat + k], x[A.col[j] * ldx + k]);
-                        F.axpyin(y[i * ldy + k + 1], A.dat[startDat + k], x[A.col[j] * ldx + k + 1]);
-                        F.axpyin(y[i * ldy + k + 2], A.dat[startDat + k], x[A.col[j] * ldx + k + 2]);
-                        F.axpyin(y[i * ldy + k + 3], A.dat[startDat + k], x[A.col[j] * ldx + k + 3]);
+                        F.axpyin(y[i * ldy + k], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k]);
+                        F.axpyin(y[i * ldy + k + 1], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 1]);
+                        F.axpyin(y[i * ldy + k + 2], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 2]);
+                        F.axpyin(y[i * ldy + k + 3], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k + 3]);
                     }
                     for (; k < blockSize; ++k)
-                        F.axpyin(y[i * ldy + k], A.dat[startDat + k], x[A.col[j] * ldx + k]);
+                        F.axpyin(y[i * ldy + k], A.dat[startDat + (j - start)], x[A.col[j] * ldx + k]);
                 }
             }
 #endif
@@ -247,13 +247,13 @@ namespace FFLAS {
                               for (uint64_t j = start; j < stop; ++j) {
                                   size_t k = 0;
                                   for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                                      y[i * blockSize + k] += A.dat[startDat + j] * x[A.col[j] * blockSize + k];
-                                      y[i * blockSize + k + 1] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 1];
-                                      y[i * blockSize + k + 2] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 2];
-                                      y[i * blockSize + k + 3] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 3];
+                                      y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
+                                      y[i * blockSize + k + 1] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 1];
+                                      y[i * blockSize + k + 2] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 2];
+                                      y[i * blockSize + k + 3] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 3];
                                   }
                                   for (; k < blockSize; ++k)
-                                      y[i * blockSize + k] += A.dat[startDat + j] * x[A.col[j] * blockSize + k];
+                                      y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
                               }
                               }
                               });
@@ -289,13 +289,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        y[i * blockSize + k] += A.dat[startDat + j] * x[A.col[j] * blockSize + k];
-                        y[i * blockSize + k + 1] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 1];
-                        y[i * blockSize + k + 2] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 2];
-                        y[i * blockSize + k + 3] += A.dat[startDat + j] * x[A.col[j] * blockSize + k + 3];
+                        y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
+                        y[i * blockSize + k + 1] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 1];
+                        y[i * blockSize + k + 2] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 2];
+                        y[i * blockSize + k + 3] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k + 3];
                     }
                     for (; k < blockSize; ++k)
-                        y[i * blockSize + k] += A.dat[startDat + j] * x[A.col[j] * blockSize + k];
+                        y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
                 }
             }
 #endif
@@ -338,13 +338,13 @@ namespace FFLAS {
                               for (uint64_t j = start; j < stop; ++j) {
                                   size_t k = 0;
                                   for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                                      y[i * ldy + k] += A.dat[startDat + j] * x[A.col[j] * ldx + k];
-                                      y[i * ldy + k + 1] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 1];
-                                      y[i * ldy + k + 2] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 2];
-                                      y[i * ldy + k + 3] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 3];
+                                      y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
+                                      y[i * ldy + k + 1] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 1];
+                                      y[i * ldy + k + 2] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 2];
+                                      y[i * ldy + k + 3] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 3];
                                   }
                                   for (; k < blockSize; ++k)
-                                      y[i * ldy + k] += A.dat[startDat + j] * x[A.col[j] * ldx + k];
+                                      y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
                               }
                               }
                               });
@@ -380,13 +380,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        y[i * ldy + k] += A.dat[startDat + j] * x[A.col[j] * ldx + k];
-                        y[i * ldy + k + 1] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 1];
-                        y[i * ldy + k + 2] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 2];
-                        y[i * ldy + k + 3] += A.dat[startDat + j] * x[A.col[j] * ldx + k + 3];
+                        y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
+                        y[i * ldy + k + 1] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 1];
+                        y[i * ldy + k + 2] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 2];
+                        y[i * ldy + k + 3] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k + 3];
                     }
                     for (; k < blockSize; ++k)
-                        y[i * ldy + k] += A.dat[startDat + j] * x[A.col[j] * ldx + k];
+                        y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
                 }
             }
 #endif
@@ -410,14 +410,14 @@ namespace FFLAS {
                               for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                               vy1 = lfunc(y + i * blockSize + k);
                               vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                              vx1 = lfunc(y + A.col[j] * blockSize + k);
-                              vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
+                              vx1 = lfunc(x + A.col[j] * blockSize + k);
+                              vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
                               sfunc(y + i * blockSize + k, simd::sub(vy1, vx1));
                               sfunc(y + i * blockSize + k + simd::vect_size, simd::sub(vy2, vx2));
                               }
                               for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                               vy1 = lfunc(y + i * blockSize + k);
-                              vx1 = lfunc(y + A.col[j] * blockSize + k);
+                              vx1 = lfunc(x + A.col[j] * blockSize + k);
                               sfunc(y + i * blockSize + k, simd::sub(vy1, vx1));
                               }
                               for (; k < blockSize; ++k)
@@ -429,14 +429,14 @@ namespace FFLAS {
                                   for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                                       vy1 = lfunc(y + i * blockSize + k);
                                       vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                                      vx1 = lfunc(y + A.col[j] * blockSize + k);
-                                      vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
+                                      vx1 = lfunc(x + A.col[j] * blockSize + k);
+                                      vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
                                       sfunc(y + i * blockSize + k, simd::add(vy1, vx1));
                                       sfunc(y + i * blockSize + k + simd::vect_size, simd::add(vy2, vx2));
                                   }
                                   for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                                       vy1 = lfunc(y + i * blockSize + k);
-                                      vx1 = lfunc(y + A.col[j] * blockSize + k);
+                                      vx1 = lfunc(x + A.col[j] * blockSize + k);
                                       sfunc(y + i * blockSize + k, simd::add(vy1, vx1));
                                   }
                                   for (; k < blockSize; ++k)
@@ -445,25 +445,23 @@ namespace FFLAS {
                               start = A.st[4 * i + 2], stop = A.st[4 * (i + 1)];
                               index_t startDat = A.st[4 * i + 3];
                               for (uint64_t j = start; j < stop; ++j) {
-                                  for (uint64_t j = start; j < stop; ++j) {
-                                      size_t k = 0;
-                                      vdat = simd::set1(A.dat[startDat + j]);
-                                      for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
-                                          vy1 = lfunc(y + i * blockSize + k);
-                                          vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                                          vx1 = lfunc(y + A.col[j] * blockSize + k);
-                                          vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
-                                          sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
-                                          sfunc(y + i * blockSize + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
-                                      }
-                                      for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
-                                          vy1 = lfunc(y + i * blockSize + k);
-                                          vx1 = lfunc(y + A.col[j] * blockSize + k);
-                                          sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
-                                      }
-                                      for (; k < blockSize; ++k)
-                                          y[i * blockSize + k] -= A.dat[startDat + j] * x[A.col[j] * blockSize + k];
+                                  size_t k = 0;
+                                  vdat = simd::set1(A.dat[startDat + (j - start)]);
+                                  for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
+                                      vy1 = lfunc(y + i * blockSize + k);
+                                      vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
+                                      vx1 = lfunc(x + A.col[j] * blockSize + k);
+                                      vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
+                                      sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
+                                      sfunc(y + i * blockSize + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                                   }
+                                  for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
+                                      vy1 = lfunc(y + i * blockSize + k);
+                                      vx1 = lfunc(x + A.col[j] * blockSize + k);
+                                      sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
+                                  }
+                                  for (; k < blockSize; ++k)
+                                      y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
                               }
                               }
                               });
@@ -477,14 +475,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = lfunc(y + i * blockSize + k);
                         vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                        vx1 = lfunc(y + A.col[j] * blockSize + k);
-                        vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
+                        vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
                         sfunc(y + i * blockSize + k, simd::sub(vy1, vx1));
                         sfunc(y + i * blockSize + k + simd::vect_size, simd::sub(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = lfunc(y + i * blockSize + k);
-                        vx1 = lfunc(y + A.col[j] * blockSize + k);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
                         sfunc(y + i * blockSize + k, simd::sub(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -496,14 +494,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = lfunc(y + i * blockSize + k);
                         vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                        vx1 = lfunc(y + A.col[j] * blockSize + k);
-                        vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
+                        vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
                         sfunc(y + i * blockSize + k, simd::add(vy1, vx1));
                         sfunc(y + i * blockSize + k + simd::vect_size, simd::add(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = lfunc(y + i * blockSize + k);
-                        vx1 = lfunc(y + A.col[j] * blockSize + k);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
                         sfunc(y + i * blockSize + k, simd::add(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -512,25 +510,23 @@ namespace FFLAS {
                 start = A.st[4 * i + 2], stop = A.st[4 * (i + 1)];
                 index_t startDat = A.st[4 * i + 3];
                 for (uint64_t j = start; j < stop; ++j) {
-                    for (uint64_t j = start; j < stop; ++j) {
-                        size_t k = 0;
-                        vdat = simd::set1(A.dat[startDat + j]);
-                        for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
-                            vy1 = lfunc(y + i * blockSize + k);
-                            vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
-                            vx1 = lfunc(y + A.col[j] * blockSize + k);
-                            vx2 = lfunc(y + A.col[j] * blockSize + k + simd::vect_size);
-                            sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
-                            sfunc(y + i * blockSize + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
-                        }
-                        for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
-                            vy1 = lfunc(y + i * blockSize + k);
-                            vx1 = lfunc(y + A.col[j] * blockSize + k);
-                            sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
-                        }
-                        for (; k < blockSize; ++k)
-                            y[i * blockSize + k] -= A.dat[startDat + j] * x[A.col[j] * blockSize + k];
+                    size_t k = 0;
+                    vdat = simd::set1(A.dat[startDat + (j - start)]);
+                    for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
+                        vy1 = lfunc(y + i * blockSize + k);
+                        vy2 = lfunc(y + i * blockSize + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
+                        vx2 = lfunc(x + A.col[j] * blockSize + k + simd::vect_size);
+                        sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
+                        sfunc(y + i * blockSize + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                     }
+                    for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
+                        vy1 = lfunc(y + i * blockSize + k);
+                        vx1 = lfunc(x + A.col[j] * blockSize + k);
+                        sfunc(y + i * blockSize + k, simd::fmadd(vy1, vdat, vx1));
+                    }
+                    for (; k < blockSize; ++k)
+                        y[i * blockSize + k] += A.dat[startDat + (j - start)] * x[A.col[j] * blockSize + k];
                 }
             }
 #endif
@@ -553,14 +549,14 @@ namespace FFLAS {
                               for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                               vy1 = lfunc(y + i * ldy + k);
                               vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                              vx1 = lfunc(y + A.col[j] * ldx + k);
-                              vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
+                              vx1 = lfunc(x + A.col[j] * ldx + k);
+                              vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
                               sfunc(y + i * ldy + k, simd::sub(vy1, vx1));
                               sfunc(y + i * ldy + k + simd::vect_size, simd::sub(vy2, vx2));
                               }
                               for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                               vy1 = lfunc(y + i * ldy + k);
-                              vx1 = lfunc(y + A.col[j] * ldx + k);
+                              vx1 = lfunc(x + A.col[j] * ldx + k);
                               sfunc(y + i * ldy + k, simd::sub(vy1, vx1));
                               }
                               for (; k < blockSize; ++k)
@@ -572,14 +568,14 @@ namespace FFLAS {
                                   for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                                       vy1 = lfunc(y + i * ldy + k);
                                       vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                                      vx1 = lfunc(y + A.col[j] * ldx + k);
-                                      vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
+                                      vx1 = lfunc(x + A.col[j] * ldx + k);
+                                      vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
                                       sfunc(y + i * ldy + k, simd::add(vy1, vx1));
                                       sfunc(y + i * ldy + k + simd::vect_size, simd::add(vy2, vx2));
                                   }
                                   for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                                       vy1 = lfunc(y + i * ldy + k);
-                                      vx1 = lfunc(y + A.col[j] * ldx + k);
+                                      vx1 = lfunc(x + A.col[j] * ldx + k);
                                       sfunc(y + i * ldy + k, simd::add(vy1, vx1));
                                   }
                                   for (; k < blockSize; ++k)
@@ -588,25 +584,23 @@ namespace FFLAS {
                               start = A.st[4 * i + 2], stop = A.st[4 * (i + 1)];
                               index_t startDat = A.st[4 * i + 3];
                               for (uint64_t j = start; j < stop; ++j) {
-                                  for (uint64_t j = start; j < stop; ++j) {
-                                      size_t k = 0;
-                                      vdat = simd::set1(A.dat[startDat + j]);
-                                      for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
-                                          vy1 = lfunc(y + i * ldy + k);
-                                          vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                                          vx1 = lfunc(y + A.col[j] * ldx + k);
-                                          vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
-                                          sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
-                                          sfunc(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
-                                      }
-                                      for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
-                                          vy1 = lfunc(y + i * ldy + k);
-                                          vx1 = lfunc(y + A.col[j] * ldx + k);
-                                          sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
-                                      }
-                                      for (; k < blockSize; ++k)
-                                          y[i * ldy + k] -= A.dat[startDat + j] * x[A.col[j] * ldx + k];
+                                  size_t k = 0;
+                                  vdat = simd::set1(A.dat[startDat + (j - start)]);
+                                  for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
+                                      vy1 = lfunc(y + i * ldy + k);
+                                      vy2 = lfunc(y + i * ldy + k + simd::vect_size);
+                                      vx1 = lfunc(x + A.col[j] * ldx + k);
+                                      vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
+                                      sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
+                                      sfunc(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                                   }
+                                  for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
+                                      vy1 = lfunc(y + i * ldy + k);
+                                      vx1 = lfunc(x + A.col[j] * ldx + k);
+                                      sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
+                                  }
+                                  for (; k < blockSize; ++k)
+                                      y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
                               }
                               }
                               });
@@ -621,14 +615,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = lfunc(y + i * ldy + k);
                         vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                        vx1 = lfunc(y + A.col[j] * ldx + k);
-                        vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
+                        vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
                         sfunc(y + i * ldy + k, simd::sub(vy1, vx1));
                         sfunc(y + i * ldy + k + simd::vect_size, simd::sub(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = lfunc(y + i * ldy + k);
-                        vx1 = lfunc(y + A.col[j] * ldx + k);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
                         sfunc(y + i * ldy + k, simd::sub(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -640,14 +634,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = lfunc(y + i * ldy + k);
                         vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                        vx1 = lfunc(y + A.col[j] * ldx + k);
-                        vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
+                        vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
                         sfunc(y + i * ldy + k, simd::add(vy1, vx1));
                         sfunc(y + i * ldy + k + simd::vect_size, simd::add(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = lfunc(y + i * ldy + k);
-                        vx1 = lfunc(y + A.col[j] * ldx + k);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
                         sfunc(y + i * ldy + k, simd::add(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -656,25 +650,23 @@ namespace FFLAS {
                 start = A.st[4 * i + 2], stop = A.st[4 * (i + 1)];
                 index_t startDat = A.st[4 * i + 3];
                 for (uint64_t j = start; j < stop; ++j) {
-                    for (uint64_t j = start; j < stop; ++j) {
-                        size_t k = 0;
-                        vdat = simd::set1(A.dat[startDat + j]);
-                        for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
-                            vy1 = lfunc(y + i * ldy + k);
-                            vy2 = lfunc(y + i * ldy + k + simd::vect_size);
-                            vx1 = lfunc(y + A.col[j] * ldx + k);
-                            vx2 = lfunc(y + A.col[j] * ldx + k + simd::vect_size);
-                            sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
-                            sfunc(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
-                        }
-                        for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
-                            vy1 = lfunc(y + i * ldy + k);
-                            vx1 = lfunc(y + A.col[j] * ldx + k);
-                            sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
-                        }
-                        for (; k < blockSize; ++k)
-                            y[i * ldy + k] -= A.dat[startDat + j] * x[A.col[j] * ldx + k];
+                    size_t k = 0;
+                    vdat = simd::set1(A.dat[startDat + (j - start)]);
+                    for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
+                        vy1 = lfunc(y + i * ldy + k);
+                        vy2 = lfunc(y + i * ldy + k + simd::vect_size);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
+                        vx2 = lfunc(x + A.col[j] * ldx + k + simd::vect_size);
+                        sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
+                        sfunc(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                     }
+                    for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
+                        vy1 = lfunc(y + i * ldy + k);
+                        vx1 = lfunc(x + A.col[j] * ldx + k);
+                        sfunc(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
+                    }
+                    for (; k < blockSize; ++k)
+                        y[i * ldy + k] += A.dat[startDat + (j - start)] * x[A.col[j] * ldx + k];
                 }
             }
 #endif
@@ -684,14 +676,16 @@ namespace FFLAS {
         template <class Field>
         inline void pfspmm(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
                            typename Field::ConstElement_ptr x, typename Field::Element_ptr y, const int64_t kmax) {
-            // TODO
+            // some rows are longer than kmax: every operation is reduced
+            pfspmm(F, A, blockSize, x, y, FieldCategories::GenericTag());
         }
 
         template <class Field>
         inline void pfspmm(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
                            typename Field::ConstElement_ptr x, int ldx, typename Field::Element_ptr y, int ldy,
                            const int64_t kmax) {
-            // TODO
+            // some rows are longer than kmax: every operation is reduced
+            pfspmm(F, A, blockSize, x, ldx, y, ldy, FieldCategories::GenericTag());
         }
 
     } // csr_hyb_details
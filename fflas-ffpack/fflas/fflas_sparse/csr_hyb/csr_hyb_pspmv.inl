@@ -205,7 +205,8 @@ namespace FFLAS {
         template <class Field>
         inline void pfspmv(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, typename Field::ConstElement_ptr x_,
                            typename Field::Element_ptr y_, const int64_t kmax) {
-            // TODO
+            // some rows are longer than kmax: every operation is reduced
+            pfspmv(F, A, x_, y_, FieldCategories::GenericTag());
         }
 
     } // CSR_HYB_details
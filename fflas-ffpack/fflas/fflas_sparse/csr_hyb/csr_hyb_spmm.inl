@@ -69,13 +69,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        F.axpyin(y[i * ldy + k], dat[startDat + k], x[col[j] * ldx + k]);
-                        F.axpyin(y[i * ldy + k + 1], dat[startDat + k], x[col[j] * ldx + k + 1]);
-                        F.axpyin(y[i * ldy + k + 2], dat[startDat + k], x[col[j] * ldx + k + 2]);
-                        F.axpyin(y[i * ldy + k + 3], dat[startDat + k], x[col[j] * ldx + k + 3]);
+                        F.axpyin(y[i * ldy + k], dat[startDat + (j - start)], x[col[j] * ldx + k]);
+                        F.axpyin(y[i * ldy + k + 1], dat[startDat + (j - start)], x[col[j] * ldx + k + 1]);
+                        F.axpyin(y[i * ldy + k + 2], dat[startDat + (j - start)], x[col[j] * ldx + k + 2]);
+                        F.axpyin(y[i * ldy + k + 3], dat[startDat + (j - start)], x[col[j] * ldx + k + 3]);
                     }
                     for (; k < blockSize; ++k)
-                        F.axpyin(y[i * ldy + k], dat[startDat + k], x[col[j] * ldx + k]);
+                        F.axpyin(y[i * ldy + k], dat[startDat + (j - start)], x[col[j] * ldx + k]);
                 }
             }
         }
@@ -119,13 +119,13 @@ namespace FFLAS {
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
                     for (; k < ROUND_DOWN(blockSize, 4); k += 4) {
-                        y[i * ldy + k] += dat[startDat + j] * x[col[j] * ldx + k];
-                        y[i * ldy + k + 1] += dat[startDat + j] * x[col[j] * ldx + k + 1];
-                        y[i * ldy + k + 2] += dat[startDat + j] * x[col[j] * ldx + k + 2];
-                        y[i * ldy + k + 3] += dat[startDat + j] * x[col[j] * ldx + k + 3];
+                        y[i * ldy + k] += dat[startDat + (j - start)] * x[col[j] * ldx + k];
+                        y[i * ldy + k + 1] += dat[startDat + (j - start)] * x[col[j] * ldx + k + 1];
+                        y[i * ldy + k + 2] += dat[startDat + (j - start)] * x[col[j] * ldx + k + 2];
+                        y[i * ldy + k + 3] += dat[startDat + (j - start)] * x[col[j] * ldx + k + 3];
                     }
                     for (; k < blockSize; ++k)
-                        y[i * ldy + k] += dat[startDat + j] * x[col[j] * ldx + k];
+                        y[i * ldy + k] += dat[startDat + (j - start)] * x[col[j] * ldx + k];
                 }
             }
         }
@@ -151,14 +151,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
                         vy2 = simd::load(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::load(y + col[j] * ldx + k);
-                        vx2 = simd::load(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::load(x + col[j] * ldx + k);
+                        vx2 = simd::load(x + col[j] * ldx + k + simd::vect_size);
                         simd::store(y + i * ldy + k, simd::sub(vy1, vx1));
                         simd::store(y + i * ldy + k + simd::vect_size, simd::sub(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
-                        vx1 = simd::load(y + col[j] * ldx + k);
+                        vx1 = simd::load(x + col[j] * ldx + k);
                         simd::store(y + i * ldy + k, simd::sub(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -170,14 +170,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
                         vy2 = simd::load(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::load(y + col[j] * ldx + k);
-                        vx2 = simd::load(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::load(x + col[j] * ldx + k);
+                        vx2 = simd::load(x + col[j] * ldx + k + simd::vect_size);
                         simd::store(y + i * ldy + k, simd::add(vy1, vx1));
                         simd::store(y + i * ldy + k + simd::vect_size, simd::add(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
-                        vx1 = simd::load(y + col[j] * ldx + k);
+                        vx1 = simd::load(x + col[j] * ldx + k);
                         simd::store(y + i * ldy + k, simd::add(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -187,22 +187,22 @@ namespace FFLAS {
                 index_t startDat = st[4 * i + 3];
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
-                    vdat = simd::set1(dat[startDat + j]);
+                    vdat = simd::set1(dat[startDat + (j - start)]);
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
                         vy2 = simd::load(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::load(y + col[j] * ldx + k);
-                        vx2 = simd::load(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::load(x + col[j] * ldx + k);
+                        vx2 = simd::load(x + col[j] * ldx + k + simd::vect_size);
                         simd::store(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
                         simd::store(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::load(y + i * ldy + k);
-                        vx1 = simd::load(y + col[j] * ldx + k);
+                        vx1 = simd::load(x + col[j] * ldx + k);
                         simd::store(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
                     }
                     for (; k < blockSize; ++k)
-                        y[i * ldy + k] -= dat[startDat + j] * x[col[j] * ldx + k];
+                        y[i * ldy + k] += dat[startDat + (j - start)] * x[col[j] * ldx + k];
                 }
             }
         }
@@ -226,14 +226,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
                         vy2 = simd::loadu(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
-                        vx2 = simd::loadu(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
+                        vx2 = simd::loadu(x + col[j] * ldx + k + simd::vect_size);
                         simd::storeu(y + i * ldy + k, simd::sub(vy1, vx1));
                         simd::storeu(y + i * ldy + k + simd::vect_size, simd::sub(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
                         simd::storeu(y + i * ldy + k, simd::sub(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -245,14 +245,14 @@ namespace FFLAS {
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
                         vy2 = simd::loadu(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
-                        vx2 = simd::loadu(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
+                        vx2 = simd::loadu(x + col[j] * ldx + k + simd::vect_size);
                         simd::storeu(y + i * ldy + k, simd::add(vy1, vx1));
                         simd::storeu(y + i * ldy + k + simd::vect_size, simd::add(vy2, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
                         simd::storeu(y + i * ldy + k, simd::add(vy1, vx1));
                     }
                     for (; k < blockSize; ++k)
@@ -262,22 +262,22 @@ namespace FFLAS {
                 index_t startDat = st[4 * i + 3];
                 for (uint64_t j = start; j < stop; ++j) {
                     size_t k = 0;
-                    vdat = simd::set1(dat[startDat + j]);
+                    vdat = simd::set1(dat[startDat + (j - start)]);
                     for (; k < ROUND_DOWN(blockSize, 2 * simd::vect_size); k += 2 * simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
                         vy2 = simd::loadu(y + i * ldy + k + simd::vect_size);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
-                        vx2 = simd::loadu(y + col[j] * ldx + k + simd::vect_size);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
+                        vx2 = simd::loadu(x + col[j] * ldx + k + simd::vect_size);
                         simd::storeu(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
                         simd::storeu(y + i * ldy + k + simd::vect_size, simd::fmadd(vy2, vdat, vx2));
                     }
                     for (; k < ROUND_DOWN(blockSize, simd::vect_size); k += simd::vect_size) {
                         vy1 = simd::loadu(y + i * ldy + k);
-                        vx1 = simd::loadu(y + col[j] * ldx + k);
+                        vx1 = simd::loadu(x + col[j] * ldx + k);
                         simd::storeu(y + i * ldy + k, simd::fmadd(vy1, vdat, vx1));
                     }
                     for (; k < blockSize; ++k)
-                        y[i * ldy + k] -= dat[startDat + j] * x[col[j] * ldx + k];
+                        y[i * ldy + k] += dat[startDat + (j - start)] * x[col[j] * ldx + k];
                 }
             }
         }
@@ -287,7 +287,8 @@ namespace FFLAS {
         inline void fspmm(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
                           typename Field::ConstElement_ptr x_, int ldx, typename Field::Element_ptr y_, int ldy,
                           const int64_t kmax) {
-            // TODO
+            // some rows are longer than kmax: every operation is reduced
+            fspmm(F, A, blockSize, x_, ldx, y_, ldy, FieldCategories::GenericTag());
         }
 
 #ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
@@ -296,14 +297,14 @@ namespace FFLAS {
         inline void fspmm_simd_aligned(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
                                        typename Field::ConstElement_ptr x, int ldx, typename Field::Element_ptr y, int ldy,
                                        uint64_t kmax) {
-            // TODO
+            fspmm(F, A, blockSize, x, ldx, y, ldy, FieldCategories::GenericTag());
         }
 
         template <class Field>
         inline void fspmm_simd_unaligned(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
                                          typename Field::ConstElement_ptr x, int ldx, typename Field::Element_ptr y, int ldy,
                                          uint64_t kmax) {
-            // TODO
+            fspmm(F, A, blockSize, x, ldx, y, ldy, FieldCategories::GenericTag());
         }
 
 #endif
@@ -118,8 +118,8 @@ namespace FFLAS {
         template <class Field>
         inline void fspmv(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, typename Field::ConstElement_ptr x_,
                           typename Field::Element_ptr y_, const uint64_t kmax) {
-            return;
-            // TODO
+            // some rows are longer than kmax: every operation is reduced
+            fspmv(F, A, x_, y_, FieldCategories::GenericTag());
         }
 
     } // CSR_HYB_details
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/csr_hyb/csr_hyb_trans.inl
+ * Transposed products y += A^T x over a range of the rows of A.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_CSR_HYB_trans_INL
+#define __FFLASFFPACK_fflas_sparse_CSR_HYB_trans_INL
+
+namespace FFLAS {
+    namespace sparse_details_impl {
+
+        /// number of the units of work of the transposed products: the rows of A
+        template <class Field>
+        inline uint64_t trans_units(const Sparse<Field, SparseMatrix_t::CSR_HYB> &A) {
+            return A.m;
+        }
+
+        template <class Field>
+        inline void fspmv_trans(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A,
+                                typename Field::ConstElement_ptr x_, typename Field::Element_ptr y_,
+                                const uint64_t iStart, const uint64_t iStop, FieldCategories::GenericTag) {
+            assume_aligned(dat, A.dat, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (uint64_t i = iStart; i < iStop; ++i) {
+                const typename Field::Element &xi = x[i];
+                for (index_t j = st[4 * i]; j < st[4 * i + 1]; ++j) {
+                    F.subin(y[col[j]], xi);
+                }
+                for (index_t j = st[4 * i + 1]; j < st[4 * i + 2]; ++j) {
+                    F.addin(y[col[j]], xi);
+                }
+                const index_t start = st[4 * i + 2], startDat = st[4 * i + 3];
+                for (index_t j = start; j < st[4 * (i + 1)]; ++j) {
+                    F.axpyin(y[col[j]], dat[startDat + (j - start)], xi);
+                }
+            }
+        }
+
+        template <class Field>
+        inline void fspmv_trans(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A,
+                                typename Field::ConstElement_ptr x_, typename Field::Element_ptr y_,
+                                const uint64_t iStart, const uint64_t iStop, FieldCategories::UnparametricTag) {
+            assume_aligned(dat, A.dat, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (uint64_t i = iStart; i < iStop; ++i) {
+                const typename Field::Element &xi = x[i];
+                for (index_t j = st[4 * i]; j < st[4 * i + 1]; ++j) {
+                    y[col[j]] -= xi;
+                }
+                for (index_t j = st[4 * i + 1]; j < st[4 * i + 2]; ++j) {
+                    y[col[j]] += xi;
+                }
+                const index_t start = st[4 * i + 2], startDat = st[4 * i + 3];
+                for (index_t j = start; j < st[4 * (i + 1)]; ++j) {
+                    y[col[j]] += dat[startDat + (j - start)] * xi;
+                }
+            }
+        }
+
+        template <class Field>
+        inline void fspmm_trans(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
+                                typename Field::ConstElement_ptr x_, int ldx, typename Field::Element_ptr y_, int ldy,
+                                const uint64_t iStart, const uint64_t iStop, FieldCategories::GenericTag) {
+            assume_aligned(dat, A.dat, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (uint64_t i = iStart; i < iStop; ++i) {
+                typename Field::ConstElement_ptr xi = x + i * ldx;
+                for (index_t j = st[4 * i]; j < st[4 * i + 1]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        F.subin(y[col[j] * ldy + k], xi[k]);
+                }
+                for (index_t j = st[4 * i + 1]; j < st[4 * i + 2]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        F.addin(y[col[j] * ldy + k], xi[k]);
+                }
+                const index_t start = st[4 * i + 2], startDat = st[4 * i + 3];
+                for (index_t j = start; j < st[4 * (i + 1)]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        F.axpyin(y[col[j] * ldy + k], dat[startDat + (j - start)], xi[k]);
+                }
+            }
+        }
+
+        template <class Field>
+        inline void fspmm_trans(const Field &F, const Sparse<Field, SparseMatrix_t::CSR_HYB> &A, size_t blockSize,
+                                typename Field::ConstElement_ptr x_, int ldx, typename Field::Element_ptr y_, int ldy,
+                                const uint64_t iStart, const uint64_t iStop, FieldCategories::UnparametricTag) {
+            assume_aligned(dat, A.dat, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(col, A.col, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(st, A.st, (size_t)Alignment::CACHE_LINE);
+            assume_aligned(x, x_, (size_t)Alignment::DEFAULT);
+            assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
+            for (uint64_t i = iStart; i < iStop; ++i) {
+                typename Field::ConstElement_ptr xi = x + i * ldx;
+                for (index_t j = st[4 * i]; j < st[4 * i + 1]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        y[col[j] * ldy + k] -= xi[k];
+                }
+                for (index_t j = st[4 * i + 1]; j < st[4 * i + 2]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        y[col[j] * ldy + k] += xi[k];
+                }
+                const index_t start = st[4 * i + 2], startDat = st[4 * i + 3];
+                for (index_t j = start; j < st[4 * (i + 1)]; ++j) {
+                    for (size_t k = 0; k < blockSize; ++k)
+                        y[col[j] * ldy + k] += dat[startDat + (j - start)] * xi[k];
+                }
+            }
+        }
+
+    } // sparse_details_impl
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_CSR_HYB_trans_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -95,6 +95,7 @@ namespace FFLAS {
             rows[row[i]]++;
 
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
 
         if (A.kmax > A.maxrow)
             A.delayed = true;
@@ -124,10 +125,6 @@ namespace FFLAS {
         for (uint64_t i = 0; i < 4 * (rowdim + 1); ++i)
             A.st[i] = 0;
 
-        for (size_t i = 0; i < nnz; ++i) {
-            A.col[i] = static_cast<index_t>(data[i].col);
-        }
-
         data.shrink_to_fit();
 
         // sort nnz by row with order -1 1 L
@@ -148,6 +145,11 @@ namespace FFLAS {
         cout << endl;
 #endif
 
+        // the columns follow the sorted entries, as do A.st
+        for (size_t i = 0; i < nnz; ++i) {
+            A.col[i] = static_cast<index_t>(data[i].col);
+        }
+
         uint64_t it = 0;
         for (size_t i = 0; i < data.size(); ++i) {
             if (!F.isOne(data[i].val) && !F.isMOne(data[i].val)) {
@@ -43,6 +43,7 @@ namespace FFLAS { /*  ELL */
         uint64_t nnz = 0;
         uint64_t nElements = 0;
         uint64_t maxrow = 0;
+        uint64_t maxcol = 0;
         index_t *col = nullptr;
         typename _Field::Element_ptr dat;
     };
@@ -52,6 +53,7 @@ namespace FFLAS { /*  ELL */
     : public Sparse<_Field, SparseMatrix_t::ELL> {
         using Field = _Field;
         typename _Field::Element cst = 1;
+        index_t *len = nullptr; //!< entries of each row, the rest up to ld is padding
     };
 
     template <class Field, class IndexT>
@@ -77,6 +79,7 @@ namespace FFLAS { /*  ELL */
 #include "fflas-ffpack/fflas/fflas_sparse/ell/ell_utils.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/ell/ell_spmv.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/ell/ell_spmm.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/ell/ell_trans.inl"
 
 #if defined(__FFLASFFPACK_USE_OPENMP) || defined(__FFLASFFPACK_USE_TBB)
 
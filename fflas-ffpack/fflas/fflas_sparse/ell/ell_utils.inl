@@ -37,6 +37,7 @@ namespace FFLAS {
 
     template <class Field> inline void sparse_delete(const Sparse<Field, SparseMatrix_t::ELL_ZO> &A) {
         fflas_delete(A.col);
+        fflas_delete(A.len);
     }
 
     template <class Field, class IndexT>
@@ -51,6 +52,7 @@ namespace FFLAS {
         for (uint64_t i = 0; i < A.nnz; ++i)
             rows[row[i]]++;
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
         // cout << "maxrow : " << A.maxrow << endl;
         A.ld = A.maxrow;
         if (A.kmax > A.maxrow)
@@ -88,15 +90,20 @@ namespace FFLAS {
         for (uint64_t i = 0; i < A.nnz; ++i)
             rows[row[i]]++;
         A.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        A.maxcol = maxColCount(col, coldim, A.nnz);
         A.ld = A.maxrow;
         if (A.kmax > A.maxrow)
             A.delayed = true;
         A.nElements = A.m * A.ld;
         A.col = fflas_new<index_t>(rowdim * A.ld, Alignment::CACHE_LINE);
+        A.len = fflas_new<index_t>(rowdim, Alignment::CACHE_LINE);
 
         for (size_t i = 0; i < rowdim * A.ld; ++i) {
             A.col[i] = 0;
         }
+        for (size_t i = 0; i < rowdim; ++i) {
+            A.len[i] = rows[i];
+        }
 
         size_t currow = row[0], it = 0;
 
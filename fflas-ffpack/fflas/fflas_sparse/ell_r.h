@@ -34,6 +34,7 @@
 namespace FFLAS { /*  ELL_R */
 
     template <class _Field> struct Sparse<_Field, SparseMatrix_t::ELL_R> {
+        using Field = _Field;
         bool delayed = false;
         uint64_t kmax = 0;
         index_t m = 0;
@@ -50,6 +51,7 @@ namespace FFLAS { /*  ELL_R */
     template <class _Field>
     struct Sparse<_Field, SparseMatrix_t::ELL_R_ZO>
     : public Sparse<_Field, SparseMatrix_t::ELL_R> {
+        using Field = _Field;
         typename _Field::Element cst = 1;
     };
 
@@ -34,6 +34,7 @@
 namespace FFLAS { /*  ELL_simd */
 
     template <class _Field> struct Sparse<_Field, SparseMatrix_t::ELL_simd> {
+        using Field = _Field;
         bool delayed = false;
         int chunk = 0;
         index_t m = 0;
@@ -51,6 +52,7 @@ namespace FFLAS { /*  ELL_simd */
     template <class _Field>
     struct Sparse<_Field, SparseMatrix_t::ELL_simd_ZO>
     : public Sparse<_Field, SparseMatrix_t::ELL_simd> {
+        using Field = _Field;
         typename _Field::Element cst = 1;
     };
 
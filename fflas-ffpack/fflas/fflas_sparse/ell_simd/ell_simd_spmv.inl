@@ -126,7 +126,7 @@ namespace FFLAS {
             assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
             index_t block = (A.ld) / kmax; // use DIVIDE_INTO from fspmvgpu
             index_t chunk = A.chunk;
-            size_t end = (A.m % chunk == 0) ? A.m : A.m + A.m % chunk;
+            size_t end = A.nChunks * chunk;
             using simd = Simd<typename Field::Element>;
             using vect_t = typename simd::vect_t;
 
@@ -174,7 +174,7 @@ namespace FFLAS {
             assume_aligned(y, y_, (size_t)Alignment::DEFAULT);
             index_t block = (A.ld) / kmax; // use DIVIDE_INTO from fspmvgpu
             index_t chunk = A.chunk;
-            size_t end = (A.m % chunk == 0) ? A.m : A.m + A.m % chunk;
+            size_t end = A.nChunks * chunk;
             for (size_t i = 0; i < end / chunk; ++i) {
                 index_t j = 0;
                 index_t j_loc = 0;
@@ -42,6 +42,7 @@ namespace FFLAS { /*  HYB_ZO */
         index_t n = 0;
         uint64_t nnz = 0;
         uint64_t maxrow = 0;
+        uint64_t maxcol = 0;
         uint64_t nElements = 0;
         Sparse<_Field, SparseMatrix_t::CSR> *dat = nullptr;
         Sparse<_Field, SparseMatrix_t::CSR_ZO> *one = nullptr;
@@ -54,6 +55,7 @@ namespace FFLAS { /*  HYB_ZO */
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_utils.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_spmv.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_spmm.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_trans.inl"
 #if defined(__FFLASFFPACK_USE_OPENMP)
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_pspmv.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/hyb_zo/hyb_zo_pspmm.inl"
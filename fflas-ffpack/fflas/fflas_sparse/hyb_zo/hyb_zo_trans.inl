@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/hyb_zo/hyb_zo_trans.inl
+ * Transposed products y += A^T x over a range of the rows of A: the three
+ * parts of A scatter in turn, each over the same rows.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_HYB_ZO_trans_INL
+#define __FFLASFFPACK_fflas_sparse_HYB_ZO_trans_INL
+
+namespace FFLAS {
+    namespace sparse_details_impl {
+
+        /// number of the units of work of the transposed products: the rows of A
+        template <class Field>
+        inline uint64_t trans_units(const Sparse<Field, SparseMatrix_t::HYB_ZO> &A) {
+            return A.m;
+        }
+
+        template <class Field, class FCat>
+        inline void fspmv_trans(const Field &F, const Sparse<Field, SparseMatrix_t::HYB_ZO> &A,
+                                typename Field::ConstElement_ptr x, typename Field::Element_ptr y,
+                                const uint64_t iStart, const uint64_t iStop, FCat) {
+            if (A.one != nullptr)
+                sparse_details_impl::fspmv_trans_one(F, *(A.one), x, y, iStart, iStop, FCat());
+            if (A.mone != nullptr)
+                sparse_details_impl::fspmv_trans_mone(F, *(A.mone), x, y, iStart, iStop, FCat());
+            if (A.dat != nullptr)
+                sparse_details_impl::fspmv_trans(F, *(A.dat), x, y, iStart, iStop, FCat());
+        }
+
+        template <class Field, class FCat>
+        inline void fspmm_trans(const Field &F, const Sparse<Field, SparseMatrix_t::HYB_ZO> &A, size_t blockSize,
+                                typename Field::ConstElement_ptr x, int ldx, typename Field::Element_ptr y, int ldy,
+                                const uint64_t iStart, const uint64_t iStop, FCat) {
+            if (A.one != nullptr)
+                sparse_details_impl::fspmm_trans_one(F, *(A.one), blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+            if (A.mone != nullptr)
+                sparse_details_impl::fspmm_trans_mone(F, *(A.mone), blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+            if (A.dat != nullptr)
+                sparse_details_impl::fspmm_trans(F, *(A.dat), blockSize, x, ldx, y, ldy, iStart, iStop, FCat());
+        }
+
+    } // sparse_details_impl
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_HYB_ZO_trans_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
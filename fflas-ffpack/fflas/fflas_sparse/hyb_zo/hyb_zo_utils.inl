@@ -32,21 +32,29 @@ namespace FFLAS {
     // #define HYB_ZO_DEBUG 1
 
     template <class Field> inline void sparse_delete(const Sparse<Field, SparseMatrix_t::HYB_ZO> &A) {
-        if (A.dat != nullptr)
+        if (A.dat != nullptr) {
             sparse_delete(*(A.dat));
-        if (A.one != nullptr)
+            delete A.dat;
+        }
+        if (A.one != nullptr) {
             sparse_delete(*(A.one));
-        if (A.mone != nullptr)
+            delete A.one;
+        }
+        if (A.mone != nullptr) {
             sparse_delete(*(A.mone));
+            delete A.mone;
+        }
     }
 
     template <class Field, class IndexT>
     inline void sparse_init(const Field &F, Sparse<Field, SparseMatrix_t::HYB_ZO> &A, const IndexT *row, const IndexT *col,
                             typename Field::ConstElement_ptr dat, uint64_t rowdim, uint64_t coldim, uint64_t nnz) {
 
+        A.kmax = Protected::DotProdBoundClassic(F, F.one);
         A.m = rowdim;
         A.n = coldim;
         A.nnz = nnz;
+        A.maxcol = maxColCount(col, coldim, nnz);
         A.delayed = true;
         A.nElements = nnz;
         uint64_t nOnes = 0, nMOnes = 0, nOthers = 0;
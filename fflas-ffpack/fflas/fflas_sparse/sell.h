@@ -41,6 +41,7 @@ namespace FFLAS { /*  SELL */
         index_t m = 0;
         index_t n = 0;
         index_t maxrow = 0;
+        index_t maxcol = 0;
         index_t sigma = 0;
         index_t nChunks = 0;
         uint64_t nnz = 0;
@@ -63,6 +64,7 @@ namespace FFLAS { /*  SELL */
 
 #include "fflas-ffpack/fflas/fflas_sparse/sell/sell_utils.inl"
 #include "fflas-ffpack/fflas/fflas_sparse/sell/sell_spmv.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/sell/sell_trans.inl"
 #if defined(__FFLASFFPACK_USE_OPENMP)
 #include "fflas-ffpack/fflas/fflas_sparse/sell/sell_pspmv.inl"
 #endif
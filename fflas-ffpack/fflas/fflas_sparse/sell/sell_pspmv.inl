@@ -164,7 +164,7 @@ namespace FFLAS {
                               y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                               y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                               }
-                              for (; k < size; ++k) {
+                              for (; k < (size_t)A.chunk; ++k) {
                               y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                               }
                               }
@@ -183,7 +183,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                         y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                     }
                 }
@@ -304,11 +304,11 @@ namespace FFLAS {
                               y[i * A.chunk + k + 3] +=
                               dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                               }
-                              for (; k < size; ++k) {
+                              for (; k < (size_t)A.chunk; ++k) {
                                   y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                               }
                               }
-                              for (size_t k = 0; k < size; ++k) {
+                              for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                                   F.reduce(y[i * A.chunk + k]);
                               }
                               }
@@ -320,11 +320,11 @@ namespace FFLAS {
                                       y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                                       y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                                   }
-                                  for (; k < size; ++k) {
+                                  for (; k < (size_t)A.chunk; ++k) {
                                       y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                                   }
                               }
-                              for (size_t k = 0; k < size; ++k) {
+                              for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                                   F.reduce(y[i * A.chunk + k]);
                               }
                               }
@@ -348,11 +348,11 @@ namespace FFLAS {
                             y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                             y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                         }
-                        for (; k < size; ++k) {
+                        for (; k < (size_t)A.chunk; ++k) {
                             y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                         }
                     }
-                    for (size_t k = 0; k < size; ++k) {
+                    for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                         F.reduce(y[i * A.chunk + k]);
                     }
                 }
@@ -364,11 +364,11 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                         y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                     }
                 }
-                for (size_t k = 0; k < size; ++k) {
+                for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                     F.reduce(y[i * A.chunk + k]);
                 }
             }
@@ -594,7 +594,7 @@ namespace FFLAS {
                               y[i * A.chunk + k + 2] += x[col[start + j * A.chunk + k + 2]];
                               y[i * A.chunk + k + 3] += x[col[start + j * A.chunk + k + 3]];
                               }
-                              for (; k < size; ++k) {
+                              for (; k < (size_t)A.chunk; ++k) {
                               y[i * A.chunk + k] += x[col[start + j * A.chunk + k]];
                               }
                               }
@@ -613,7 +613,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += x[col[start + j * A.chunk + k + 2]];
                         y[i * A.chunk + k + 3] += x[col[start + j * A.chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += x[col[start + j * A.chunk + k]];
                     }
                 }
@@ -644,7 +644,7 @@ namespace FFLAS {
                               y[i * A.chunk + k + 2] -= x[col[start + j * A.chunk + k + 2]];
                               y[i * A.chunk + k + 3] -= x[col[start + j * A.chunk + k + 3]];
                               }
-                              for (; k < size; ++k) {
+                              for (; k < (size_t)A.chunk; ++k) {
                               y[i * A.chunk + k] -= x[col[start + j * A.chunk + k]];
                               }
                               }
@@ -663,7 +663,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] -= x[col[start + j * A.chunk + k + 2]];
                         y[i * A.chunk + k + 3] -= x[col[start + j * A.chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] -= x[col[start + j * A.chunk + k]];
                     }
                 }
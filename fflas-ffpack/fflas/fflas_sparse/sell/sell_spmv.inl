@@ -112,7 +112,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += dat[start + j * A.chunk + k + 2] * x[col[start + j * A.chunk + k + 2]];
                         y[i * A.chunk + k + 3] += dat[start + j * A.chunk + k + 3] * x[col[start + j * A.chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += dat[start + j * A.chunk + k] * x[col[start + j * A.chunk + k]];
                     }
                 }
@@ -194,11 +194,11 @@ namespace FFLAS {
                             y[i * A.chunk + k + 2] += dat[start + j * chunk + k + 2] * x[col[start + j * chunk + k + 2]];
                             y[i * A.chunk + k + 3] += dat[start + j * chunk + k + 3] * x[col[start + j * chunk + k + 3]];
                         }
-                        for (; k < size; ++k) {
+                        for (; k < (size_t)A.chunk; ++k) {
                             y[i * A.chunk + k] += dat[start + j * chunk + k] * x[col[start + j * chunk + k]];
                         }
                     }
-                    for (size_t k = 0; k < size; ++k) {
+                    for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                         F.reduce(y[i * A.chunk + k]);
                     }
                 }
@@ -210,11 +210,11 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += dat[start + j * chunk + k + 2] * x[col[start + j * chunk + k + 2]];
                         y[i * A.chunk + k + 3] += dat[start + j * chunk + k + 3] * x[col[start + j * chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += dat[start + j * chunk + k] * x[col[start + j * chunk + k]];
                     }
                 }
-                for (size_t k = 0; k < size; ++k) {
+                for (size_t k = 0; k < (size_t)A.chunk; ++k) {
                     F.reduce(y[i * A.chunk + k]);
                 }
             }
@@ -352,7 +352,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] += x[col[start + j * chunk + k + 2]];
                         y[i * A.chunk + k + 3] += x[col[start + j * chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] += x[col[start + j * chunk + k]];
                     }
                 }
@@ -380,7 +380,7 @@ namespace FFLAS {
                         y[i * A.chunk + k + 2] -= x[col[start + j * chunk + k + 2]];
                         y[i * A.chunk + k + 3] -= x[col[start + j * chunk + k + 3]];
                     }
-                    for (; k < size; ++k) {
+                    for (; k < (size_t)A.chunk; ++k) {
                         y[i * A.chunk + k] -= x[col[start + j * chunk + k]];
                     }
                 }
@@ -41,12 +41,14 @@ namespace FFLAS {
         fflas_delete(A.col);
         fflas_delete(A.st);
         fflas_delete(A.chunkSize);
+        fflas_delete(A.perm);
     }
 
     template <class Field> inline void sparse_delete(const Sparse<Field, SparseMatrix_t::SELL_ZO> &A) {
         fflas_delete(A.col);
         fflas_delete(A.st);
         fflas_delete(A.chunkSize);
+        fflas_delete(A.perm);
     }
 
     namespace sell_details {
@@ -137,6 +139,7 @@ namespace FFLAS {
 
         A.maxrow = (std::max_element(infos.begin(), infos.end(),
                                      [](const Info &a, const Info &b) { return a.size >= b.size; }))->size;
+        A.maxcol = maxColCount(col, coldim, nnz);
 
         // cout << "maxrow : " << A.maxrow << endl;
 
@@ -156,11 +159,11 @@ namespace FFLAS {
 
         uint64_t it = 0;
         for (; it < ROUND_DOWN(rowdim, sigma); it += sigma) {
-            std::sort(infos.begin() + it, infos.begin() + it + sigma,
-                      [](const Info &a, const Info &b) { return a.size >= b.size; });
+            std::stable_sort(infos.begin() + it, infos.begin() + it + sigma,
+                             [](const Info &a, const Info &b) { return a.size > b.size; });
         }
         if (it != rowdim) {
-            std::sort(infos.begin() + it, infos.end(), [](Info a, Info b) { return a.size >= b.size; });
+            std::stable_sort(infos.begin() + it, infos.end(), [](const Info &a, const Info &b) { return a.size > b.size; });
         }
 
         // cout << "sorted : " << std::is_sorted(infos.begin(), infos.end(), [](Info
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/sparse_auto.h
+ * @brief Sparse matrix in a format picked at run time.
+ *
+ * sparse_init samples the row lengths, the fraction of entries equal to 1
+ * or -1 and the SIMD width of the field elements, and builds the matrix in
+ * the format expected to give the fastest SpMV among CSR, ELL, ELL_simd,
+ * SELL, CSR_HYB and HYB_ZO. With trial set, the candidate formats are also
+ * built and timed on a few SpMV on this machine, and the fastest is kept.
+ *
+ * fspmv, fspmm and pfspmv are forwarded to the chosen format. The SELL row
+ * permutation is undone, so that y is always in the row order of A.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_AUTO_H
+#define __FFLASFFPACK_fflas_sparse_AUTO_H
+
+// largest (padded entries)/nnz for which ELL and ELL_simd are picked
+#ifndef __FFLASFFPACK_SPARSE_AUTO_ELL_FILL
+#define __FFLASFFPACK_SPARSE_AUTO_ELL_FILL 1.25
+#endif
+// largest (padded entries)/nnz for which SELL is picked
+#ifndef __FFLASFFPACK_SPARSE_AUTO_SELL_FILL
+#define __FFLASFFPACK_SPARSE_AUTO_SELL_FILL 1.5
+#endif
+// smallest fraction of +-1 entries for which CSR_HYB, resp. HYB_ZO, is picked
+#ifndef __FFLASFFPACK_SPARSE_AUTO_HYB_PM1
+#define __FFLASFFPACK_SPARSE_AUTO_HYB_PM1 0.3
+#endif
+#ifndef __FFLASFFPACK_SPARSE_AUTO_ZO_PM1
+#define __FFLASFFPACK_SPARSE_AUTO_ZO_PM1 0.9
+#endif
+
+namespace FFLAS { /*  AUTO */
+
+    template <class _Field> struct Sparse<_Field, SparseMatrix_t::AUTO> {
+        using Field = _Field;
+        SparseMatrix_t format = SparseMatrix_t::CSR; //!< format picked by sparse_init
+        index_t m = 0;
+        index_t n = 0;
+        uint64_t nnz = 0;
+        uint64_t maxrow = 0;
+        uint64_t nOnes = 0;
+        uint64_t nMOnes = 0;
+        // only the matrix of the chosen format is allocated
+        Sparse<_Field, SparseMatrix_t::CSR> *csr = nullptr;
+        Sparse<_Field, SparseMatrix_t::ELL> *ell = nullptr;
+        Sparse<_Field, SparseMatrix_t::ELL_simd> *ell_simd = nullptr;
+        Sparse<_Field, SparseMatrix_t::SELL> *sell = nullptr;
+        Sparse<_Field, SparseMatrix_t::CSR_HYB> *csr_hyb = nullptr;
+        Sparse<_Field, SparseMatrix_t::HYB_ZO> *hyb_zo = nullptr;
+    };
+
+    template <class Field> using SparseAuto = Sparse<Field, SparseMatrix_t::AUTO>;
+
+    /// Statistics of a matrix driving the choice of its format
+    struct SparseAutoStats {
+        uint64_t m = 0;
+        uint64_t nnz = 0;
+        uint64_t maxrow = 0;
+        uint64_t nOnes = 0;
+        uint64_t nMOnes = 0;
+        size_t simd = 1;       //!< number of elements in a SIMD vector, 1 without SIMD kernels
+        double ellFill = 1.;   //!< m.maxrow/nnz, the storage overhead of ELL
+        double sellFill = 1.;  //!< storage overhead of SELL with chunks of simd rows
+        double pm1 = 0.;       //!< fraction of the entries equal to 1 or -1
+    };
+
+    template <class Field, class IndexT>
+    inline SparseAutoStats sparse_auto_stats(const Field &F, const IndexT *row, typename Field::ConstElement_ptr dat,
+                                             uint64_t rowdim, uint64_t nnz);
+
+    /// format picked from the statistics only
+    inline SparseMatrix_t sparse_auto_choose(const SparseAutoStats &S);
+
+    /** Builds A from the nnz triples (row, col, dat), sorted by rows.
+     * With trial, the candidate formats are timed on this machine.
+     */
+    template <class Field, class IndexT>
+    inline void sparse_init(const Field &F, Sparse<Field, SparseMatrix_t::AUTO> &A,
+                            const IndexT *row, const IndexT *col,
+                            typename Field::ConstElement_ptr dat, uint64_t rowdim,
+                            uint64_t coldim, uint64_t nnz, bool trial = false);
+
+    template <class Field>
+    inline void sparse_delete(const Sparse<Field, SparseMatrix_t::AUTO> &A);
+
+    template <class Field>
+    inline void fspmv(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, typename Field::ConstElement_ptr x,
+                      const typename Field::Element &beta, typename Field::Element_ptr y);
+
+    template <class Field>
+    inline void fspmm(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, size_t blockSize,
+                      typename Field::ConstElement_ptr x, int ldx, const typename Field::Element &beta,
+                      typename Field::Element_ptr y, int ldy);
+
+#if defined(__FFLASFFPACK_USE_OPENMP)
+    template <class Field>
+    inline void pfspmv(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, typename Field::ConstElement_ptr x,
+                       const typename Field::Element &beta, typename Field::Element_ptr y);
+#endif
+
+} // FFLAS
+
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_auto/sparse_auto_utils.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_auto/sparse_auto_spmv.inl"
+
+#endif // __FFLASFFPACK_fflas_sparse_AUTO_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_AUTO_spmv_INL
+#define __FFLASFFPACK_fflas_sparse_AUTO_spmv_INL
+
+namespace FFLAS {
+
+    namespace sparse_auto_details {
+
+        // y <- A x + beta y in the row order of A, from the permuted output t of SELL
+        template <class Field>
+        inline void unpermute(const Field &F, const Sparse<Field, SparseMatrix_t::SELL> &A,
+                              typename Field::ConstElement_ptr t, const typename Field::Element &beta,
+                              typename Field::Element_ptr y) {
+            if (!F.isOne(beta))
+                fscalin(F, A.m, beta, y, 1);
+            for (index_t i = 0; i < A.m; ++i)
+                F.addin(y[i], t[A.perm[i]]);
+        }
+
+        // the kernels of ELL_simd write whole chunks of rows: unless A.m is a multiple of the
+        // chunk, y goes through a temporary of nChunks*chunk rows holding its first A.m rows
+        template <class Field>
+        inline typename Field::Element_ptr pad(const Field &F, const Sparse<Field, SparseMatrix_t::ELL_simd> &A,
+                                               typename Field::ConstElement_ptr y) {
+            const uint64_t rows = A.nChunks * A.chunk;
+            if (rows == A.m)
+                return nullptr;
+            auto t = fflas_new(F, rows, Alignment::CACHE_LINE);
+            fassign(F, A.m, y, 1, t, 1);
+            fzero(F, rows - A.m, t + A.m, 1);
+            return t;
+        }
+
+        // copies back the first A.m rows of the temporary t of pad, if any
+        template <class Field>
+        inline void unpad(const Field &F, const Sparse<Field, SparseMatrix_t::ELL_simd> &A,
+                          typename Field::Element_ptr t, typename Field::Element_ptr y) {
+            if (t == nullptr)
+                return;
+            fassign(F, A.m, t, 1, y, 1);
+            fflas_delete(t);
+        }
+
+    } // sparse_auto_details
+
+    template <class Field>
+    inline void fspmv(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, typename Field::ConstElement_ptr x,
+                      const typename Field::Element &beta, typename Field::Element_ptr y) {
+        switch (A.format) {
+        case SparseMatrix_t::ELL:
+            fspmv(F, *(A.ell), x, beta, y);
+            break;
+        case SparseMatrix_t::ELL_simd: {
+            auto t = sparse_auto_details::pad(F, *(A.ell_simd), y);
+            fspmv(F, *(A.ell_simd), x, beta, t ? t : y);
+            sparse_auto_details::unpad(F, *(A.ell_simd), t, y);
+            break;
+        }
+        case SparseMatrix_t::SELL: {
+            auto t = fflas_new(F, A.sell->nChunks * A.sell->chunk, Alignment::CACHE_LINE);
+            fspmv(F, *(A.sell), x, F.zero, t);
+            sparse_auto_details::unpermute(F, *(A.sell), t, beta, y);
+            fflas_delete(t);
+            break;
+        }
+        case SparseMatrix_t::CSR_HYB:
+            fspmv(F, *(A.csr_hyb), x, beta, y);
+            break;
+        case SparseMatrix_t::HYB_ZO:
+            fspmv(F, *(A.hyb_zo), x, beta, y);
+            break;
+        default:
+            fspmv(F, *(A.csr), x, beta, y);
+        }
+    }
+
+    // ELL_simd and SELL have no SpMM kernel: they get one SpMV per column of x, whose
+    // padded rows are handled by fspmv, so that yk has the A.m rows of y
+    template <class Field>
+    inline void fspmm(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, size_t blockSize,
+                      typename Field::ConstElement_ptr x, int ldx, const typename Field::Element &beta,
+                      typename Field::Element_ptr y, int ldy) {
+        switch (A.format) {
+        case SparseMatrix_t::ELL:
+            fspmm(F, *(A.ell), blockSize, x, ldx, beta, y, ldy);
+            break;
+        case SparseMatrix_t::CSR_HYB:
+            fspmm(F, *(A.csr_hyb), blockSize, x, ldx, beta, y, ldy);
+            break;
+        case SparseMatrix_t::HYB_ZO:
+            fspmm(F, *(A.hyb_zo), blockSize, x, ldx, beta, y, ldy);
+            break;
+        case SparseMatrix_t::ELL_simd:
+        case SparseMatrix_t::SELL: {
+            auto xk = fflas_new(F, A.n, Alignment::CACHE_LINE);
+            auto yk = fflas_new(F, A.m, Alignment::CACHE_LINE);
+            for (size_t k = 0; k < blockSize; ++k) {
+                fassign(F, A.n, x + k, ldx, xk, 1);
+                fassign(F, A.m, y + k, ldy, yk, 1);
+                fspmv(F, A, xk, beta, yk);
+                fassign(F, A.m, yk, 1, y + k, ldy);
+            }
+            fflas_delete(xk);
+            fflas_delete(yk);
+            break;
+        }
+        default:
+            fspmm(F, *(A.csr), blockSize, x, ldx, beta, y, ldy);
+        }
+    }
+
+#if defined(__FFLASFFPACK_USE_OPENMP)
+    template <class Field>
+    inline void pfspmv(const Field &F, const Sparse<Field, SparseMatrix_t::AUTO> &A, typename Field::ConstElement_ptr x,
+                       const typename Field::Element &beta, typename Field::Element_ptr y) {
+        switch (A.format) {
+        case SparseMatrix_t::ELL:
+            pfspmv(F, *(A.ell), x, beta, y);
+            break;
+        case SparseMatrix_t::ELL_simd: {
+            auto t = sparse_auto_details::pad(F, *(A.ell_simd), y);
+            pfspmv(F, *(A.ell_simd), x, beta, t ? t : y);
+            sparse_auto_details::unpad(F, *(A.ell_simd), t, y);
+            break;
+        }
+        case SparseMatrix_t::SELL: {
+            auto t = fflas_new(F, A.sell->nChunks * A.sell->chunk, Alignment::CACHE_LINE);
+            pfspmv(F, *(A.sell), x, F.zero, t);
+            sparse_auto_details::unpermute(F, *(A.sell), t, beta, y);
+            fflas_delete(t);
+            break;
+        }
+        case SparseMatrix_t::CSR_HYB:
+            pfspmv(F, *(A.csr_hyb), x, beta, y);
+            break;
+        case SparseMatrix_t::HYB_ZO:
+            pfspmv(F, *(A.hyb_zo), x, beta, y);
+            break;
+        default:
+            pfspmv(F, *(A.csr), x, beta, y);
+        }
+    }
+#endif // __FFLASFFPACK_USE_OPENMP
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_AUTO_spmv_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_AUTO_utils_INL
+#define __FFLASFFPACK_fflas_sparse_AUTO_utils_INL
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "fflas-ffpack/utils/timer.h"
+
+// number of timed SpMV per candidate format in the trial of sparse_init
+#ifndef __FFLASFFPACK_SPARSE_AUTO_TRIALS
+#define __FFLASFFPACK_SPARSE_AUTO_TRIALS 3
+#endif
+
+namespace FFLAS {
+
+    namespace sparse_auto_details {
+
+        // width of the vectors of the SIMD sparse kernels, 1 when they are not used
+        template <class Element, bool = support_simd<Element>::value> struct simd_width {
+            static constexpr size_t value = 1;
+        };
+
+#ifdef __FFLASFFPACK_HAVE_SSE4_1_INSTRUCTIONS
+        template <class Element> struct simd_width<Element, true> {
+            static constexpr size_t value = Simd<Element>::vect_size;
+        };
+#endif
+
+        template <class Field, SparseMatrix_t Fmt, class IndexT>
+        inline Sparse<Field, Fmt> *build(const Field &F, const IndexT *row, const IndexT *col,
+                                         typename Field::ConstElement_ptr dat, uint64_t rowdim, uint64_t coldim,
+                                         uint64_t nnz) {
+            auto B = new Sparse<Field, Fmt>;
+            sparse_init(F, *B, row, col, dat, rowdim, coldim, nnz);
+            return B;
+        }
+
+        template <class Field, class IndexT>
+        inline void build(const Field &F, Sparse<Field, SparseMatrix_t::AUTO> &A, SparseMatrix_t fmt,
+                          const IndexT *row, const IndexT *col, typename Field::ConstElement_ptr dat,
+                          uint64_t rowdim, uint64_t coldim, uint64_t nnz) {
+            A.format = fmt;
+            switch (fmt) {
+            case SparseMatrix_t::ELL:
+                A.ell = build<Field, SparseMatrix_t::ELL>(F, row, col, dat, rowdim, coldim, nnz);
+                break;
+            case SparseMatrix_t::ELL_simd:
+                A.ell_simd = build<Field, SparseMatrix_t::ELL_simd>(F, row, col, dat, rowdim, coldim, nnz);
+                break;
+            case SparseMatrix_t::SELL:
+                A.sell = build<Field, SparseMatrix_t::SELL>(F, row, col, dat, rowdim, coldim, nnz);
+                break;
+            case SparseMatrix_t::CSR_HYB:
+                A.csr_hyb = build<Field, SparseMatrix_t::CSR_HYB>(F, row, col, dat, rowdim, coldim, nnz);
+                break;
+            case SparseMatrix_t::HYB_ZO:
+                A.hyb_zo = build<Field, SparseMatrix_t::HYB_ZO>(F, row, col, dat, rowdim, coldim, nnz);
+                break;
+            default:
+                A.format = SparseMatrix_t::CSR;
+                A.csr = build<Field, SparseMatrix_t::CSR>(F, row, col, dat, rowdim, coldim, nnz);
+            }
+        }
+
+        template <class SM> inline void release(SM *B) {
+            if (B != nullptr) {
+                sparse_delete(*B);
+                delete B;
+            }
+        }
+
+        template <class Field> inline void release(const Sparse<Field, SparseMatrix_t::AUTO> &A) {
+            release(A.csr);
+            release(A.ell);
+            release(A.ell_simd);
+            release(A.sell);
+            release(A.csr_hyb);
+            release(A.hyb_zo);
+        }
+
+    } // sparse_auto_details
+
+    template <class Field, class IndexT>
+    inline SparseAutoStats sparse_auto_stats(const Field &F, const IndexT *row, typename Field::ConstElement_ptr dat,
+                                             uint64_t rowdim, uint64_t nnz) {
+        SparseAutoStats S;
+        S.m = rowdim;
+        S.nnz = nnz;
+        S.simd = sparse_auto_details::simd_width<typename Field::Element>::value;
+        if (!nnz || !rowdim)
+            return S;
+        std::vector<uint64_t> rows(rowdim, 0);
+        for (uint64_t i = 0; i < nnz; ++i) {
+            rows[row[i]]++;
+            if (F.isOne(dat[i]))
+                S.nOnes++;
+            else if (F.isMOne(dat[i]))
+                S.nMOnes++;
+        }
+        S.maxrow = *(std::max_element(rows.begin(), rows.end()));
+        S.ellFill = double(rowdim) * double(S.maxrow) / double(nnz);
+        S.pm1 = double(S.nOnes + S.nMOnes) / double(nnz);
+        // SELL sorts the rows by decreasing lengths and pads each chunk to its longest row
+        const uint64_t chunk = (S.simd > 1) ? S.simd : 8;
+        std::sort(rows.begin(), rows.end(), std::greater<uint64_t>());
+        uint64_t padded = 0;
+        for (uint64_t i = 0; i < rowdim; i += chunk)
+            padded += chunk * rows[i];
+        S.sellFill = double(padded) / double(nnz);
+        return S;
+    }
+
+    inline SparseMatrix_t sparse_auto_choose(const SparseAutoStats &S) {
+        if (!S.nnz)
+            return SparseMatrix_t::CSR;
+        if (S.pm1 >= __FFLASFFPACK_SPARSE_AUTO_ZO_PM1)
+            return SparseMatrix_t::HYB_ZO;
+        if (S.simd > 1 && S.ellFill <= __FFLASFFPACK_SPARSE_AUTO_ELL_FILL)
+            return SparseMatrix_t::ELL_simd;
+        if (S.simd > 1 && S.sellFill <= __FFLASFFPACK_SPARSE_AUTO_SELL_FILL)
+            return SparseMatrix_t::SELL;
+        if (S.pm1 >= __FFLASFFPACK_SPARSE_AUTO_HYB_PM1)
+            return SparseMatrix_t::CSR_HYB;
+        if (S.ellFill <= __FFLASFFPACK_SPARSE_AUTO_ELL_FILL)
+            return SparseMatrix_t::ELL;
+        return SparseMatrix_t::CSR;
+    }
+
+    template <class Field, class IndexT>
+    inline void sparse_init(const Field &F, Sparse<Field, SparseMatrix_t::AUTO> &A, const IndexT *row, const IndexT *col,
+                            typename Field::ConstElement_ptr dat, uint64_t rowdim, uint64_t coldim, uint64_t nnz,
+                            bool trial) {
+        const SparseAutoStats S = sparse_auto_stats(F, row, dat, rowdim, nnz);
+        A.m = rowdim;
+        A.n = coldim;
+        A.nnz = nnz;
+        A.maxrow = S.maxrow;
+        A.nOnes = S.nOnes;
+        A.nMOnes = S.nMOnes;
+        const SparseMatrix_t guess = sparse_auto_choose(S);
+        if (!trial || !nnz) {
+            sparse_auto_details::build(F, A, guess, row, col, dat, rowdim, coldim, nnz);
+            return;
+        }
+
+        // candidates: the guess, CSR, and the formats the statistics do not rule out
+        std::vector<SparseMatrix_t> cand(1, guess);
+        auto add = [&cand](SparseMatrix_t f) {
+            if (std::find(cand.begin(), cand.end(), f) == cand.end())
+                cand.push_back(f);
+        };
+        add(SparseMatrix_t::CSR);
+        if (S.ellFill <= 2 * __FFLASFFPACK_SPARSE_AUTO_ELL_FILL)
+            add((S.simd > 1) ? SparseMatrix_t::ELL_simd : SparseMatrix_t::ELL);
+        if (S.simd > 1 && S.sellFill <= 2 * __FFLASFFPACK_SPARSE_AUTO_SELL_FILL)
+            add(SparseMatrix_t::SELL);
+        if (S.pm1 > 0) {
+            add(SparseMatrix_t::CSR_HYB);
+            add(SparseMatrix_t::HYB_ZO);
+        }
+
+        typename Field::Element_ptr x = fflas_new(F, coldim, Alignment::CACHE_LINE);
+        typename Field::Element_ptr y = fflas_new(F, rowdim, Alignment::CACHE_LINE);
+        for (uint64_t j = 0; j < coldim; ++j)
+            F.assign(x[j], F.one);
+        SparseMatrix_t best = guess;
+        double tbest = -1;
+        for (auto f : cand) {
+            Sparse<Field, SparseMatrix_t::AUTO> B;
+            B.m = A.m;
+            B.n = A.n;
+            B.nnz = A.nnz;
+            sparse_auto_details::build(F, B, f, row, col, dat, rowdim, coldim, nnz);
+            fspmv(F, B, x, F.zero, y); // warm up
+            double t = -1;
+            for (size_t r = 0; r < __FFLASFFPACK_SPARSE_AUTO_TRIALS; ++r) {
+                Timer chrono;
+                chrono.start();
+                fspmv(F, B, x, F.zero, y);
+                chrono.stop();
+                if (t < 0 || chrono.realtime() < t)
+                    t = chrono.realtime();
+            }
+            if (tbest < 0 || t < tbest) {
+                tbest = t;
+                best = f;
+            }
+            sparse_auto_details::release(B);
+        }
+        fflas_delete(x);
+        fflas_delete(y);
+        sparse_auto_details::build(F, A, best, row, col, dat, rowdim, coldim, nnz);
+    }
+
+    template <class Field> inline void sparse_delete(const Sparse<Field, SparseMatrix_t::AUTO> &A) {
+        sparse_auto_details::release(A);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_AUTO_utils_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
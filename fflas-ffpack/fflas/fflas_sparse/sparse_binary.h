@@ -0,0 +1,440 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/sparse_binary.h
+ * @brief Binary on-disk layout of the sparse matrices, loadable without copy.
+ *
+ * sparse_write_binary stores a matrix of format CSR, CSR_ZO, COO, COO_ZO,
+ * ELL, ELL_ZO, SELL or CSR_HYB as it is laid out in memory. The file starts
+ * with a header of 64-bit words:
+ *
+ *     magic, version, format, sizeof(Element), sizeof(index_t), characteristic,
+ *     minimal and maximal elements of the field,
+ *     number s of scalars, number a of arrays,
+ *     the s scalar fields of the matrix,
+ *     a pairs (offset, size in bytes) of its arrays
+ *
+ * followed by the arrays, each at an offset multiple of the cache line.
+ * The extreme elements tell apart the representations of a same field,
+ * such as Modular and ModularBalanced, whose kernels would misread the
+ * entries of one another.
+ *
+ * sparse_map_binary maps such a file in memory and points the arrays of
+ * the matrix into the mapping, which the kernels then use in place: the
+ * matrix is valid until sparse_unmap, and must not be given to
+ * sparse_delete. The mapping is private: the pages are only read from
+ * disk when touched, and never written back. sparse_read_binary copies
+ * the arrays instead, into a matrix released by sparse_delete, and
+ * sparse_load_binary points a matrix into an image already in memory.
+ * All of them leave the matrix untouched when they throw.
+ *
+ * The element type must be a machine type: the files are only readable on
+ * machines with the same endianness and the same index_t.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_BINARY_H
+#define __FFLASFFPACK_fflas_sparse_BINARY_H
+
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define __FFLASFFPACK_SPARSE_BINARY_MMAP 1
+#endif
+
+namespace FFLAS {
+
+    /// A file mapped by sparse_map_binary
+    struct SparseMapping {
+        char *base = nullptr;
+        size_t size = 0;
+        bool mapped = false; //!< false when the file was read into memory instead
+    };
+
+    namespace sparse_binary_details {
+
+        static const uint64_t magic = 0x42505346414c4646ULL; // "FFLASFPB"
+        static const uint64_t version = 2;
+        static const uint64_t align = (uint64_t)Alignment::CACHE_LINE;
+        static const uint64_t nwords = 10; // header words before the scalars
+
+        template <SparseMatrix_t Fmt> using format = std::integral_constant<SparseMatrix_t, Fmt>;
+
+        /*************************************************************************************
+         *
+         *      fields of each format, the scalars first
+         *
+         *************************************************************************************/
+
+        template <class M, class V> inline void csr_scalars(M &A, V &v) {
+            v.scalar(A.delayed);
+            v.scalar(A.kmax);
+            v.scalar(A.m);
+            v.scalar(A.n);
+            v.scalar(A.nnz);
+            v.scalar(A.nElements);
+            v.scalar(A.maxrow);
+            v.scalar(A.maxcol);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::CSR>) {
+            csr_scalars(A, v);
+            v.array(A.st, (uint64_t)A.m + 1);
+            v.array(A.col, A.nnz);
+            v.array(A.dat, A.nnz);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::CSR_ZO>) {
+            csr_scalars(A, v);
+            v.scalar(A.cst);
+            v.array(A.st, (uint64_t)A.m + 1);
+            v.array(A.col, A.nnz);
+        }
+
+        template <class M, class V> inline void coo_scalars(M &A, V &v) {
+            v.scalar(A.delayed);
+            v.scalar(A.kmax);
+            v.scalar(A.m);
+            v.scalar(A.n);
+            v.scalar(A.nnz);
+            v.scalar(A.nElements);
+            v.scalar(A.maxrow);
+            v.scalar(A.maxcol);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::COO>) {
+            coo_scalars(A, v);
+            v.array(A.row, A.nnz);
+            v.array(A.col, A.nnz);
+            v.array(A.dat, A.nnz);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::COO_ZO>) {
+            coo_scalars(A, v);
+            v.scalar(A.cst);
+            v.array(A.row, A.nnz);
+            v.array(A.col, A.nnz);
+        }
+
+        template <class M, class V> inline void ell_scalars(M &A, V &v) {
+            v.scalar(A.delayed);
+            v.scalar(A.kmax);
+            v.scalar(A.m);
+            v.scalar(A.n);
+            v.scalar(A.ld);
+            v.scalar(A.nnz);
+            v.scalar(A.nElements);
+            v.scalar(A.maxrow);
+            v.scalar(A.maxcol);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::ELL>) {
+            ell_scalars(A, v);
+            v.array(A.col, (uint64_t)A.m * A.ld);
+            v.array(A.dat, (uint64_t)A.m * A.ld);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::ELL_ZO>) {
+            ell_scalars(A, v);
+            v.scalar(A.cst);
+            v.array(A.col, (uint64_t)A.m * A.ld);
+            v.array(A.len, (uint64_t)A.m);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::SELL>) {
+            v.scalar(A.delayed);
+            v.scalar(A.chunk);
+            v.scalar(A.kmax);
+            v.scalar(A.m);
+            v.scalar(A.n);
+            v.scalar(A.maxrow);
+            v.scalar(A.maxcol);
+            v.scalar(A.sigma);
+            v.scalar(A.nChunks);
+            v.scalar(A.nnz);
+            v.scalar(A.nElements);
+            v.array(A.perm, (uint64_t)A.m);
+            v.array(A.st, (uint64_t)A.nChunks);
+            v.array(A.chunkSize, (uint64_t)A.nChunks);
+            v.array(A.col, A.nElements);
+            v.array(A.dat, A.nElements);
+        }
+
+        template <class M, class V> inline void visit(M &A, V &v, format<SparseMatrix_t::CSR_HYB>) {
+            v.scalar(A.delayed);
+            v.scalar(A.kmax);
+            v.scalar(A.m);
+            v.scalar(A.n);
+            v.scalar(A.nnz);
+            v.scalar(A.nElements);
+            v.scalar(A.maxrow);
+            v.scalar(A.maxcol);
+            v.scalar(A.nOnes);
+            v.scalar(A.nMOnes);
+            v.scalar(A.nOthers);
+            v.array(A.st, 4 * ((uint64_t)A.m + 1));
+            v.array(A.col, A.nnz);
+            v.array(A.dat, A.nOthers);
+        }
+
+        /*************************************************************************************
+         *
+         *      visitors
+         *
+         *************************************************************************************/
+
+        // a scalar field in a 64-bit word
+        template <class T> inline uint64_t pack(const T &x) {
+            static_assert(sizeof(T) <= sizeof(uint64_t), "scalar field larger than 64 bits");
+            uint64_t w = 0;
+            std::memcpy(&w, &x, sizeof(T));
+            return w;
+        }
+
+        template <class T> inline void unpack(T &x, const uint64_t w) { std::memcpy(&x, &w, sizeof(T)); }
+
+        // collects the fields of a matrix
+        struct Collector {
+            std::vector<uint64_t> scalars;
+            std::vector<const char *> ptrs;
+            std::vector<uint64_t> bytes;
+
+            template <class T> void scalar(const T &x) { scalars.push_back(pack(x)); }
+
+            template <class T> void array(T *const &p, uint64_t count) {
+                ptrs.push_back(reinterpret_cast<const char *>(p));
+                bytes.push_back(count * sizeof(T));
+            }
+        };
+
+        // sets the fields of a matrix from a mapped file
+        struct Loader {
+            const uint64_t *header;
+            const char *base;
+            size_t size;
+            uint64_t ns, na, is = 0, ia = 0;
+
+            Loader(const char *b, size_t s) : header(reinterpret_cast<const uint64_t *>(b)), base(b), size(s) {
+                ns = header[nwords - 2];
+                na = header[nwords - 1];
+            }
+
+            template <class T> void scalar(T &x) {
+                if (is >= ns)
+                    throw std::runtime_error("sparse binary: missing scalar field");
+                unpack(x, header[nwords + is++]);
+            }
+
+            template <class T> void array(T *&p, uint64_t count) {
+                if (ia >= na)
+                    throw std::runtime_error("sparse binary: missing array");
+                const uint64_t *entry = header + nwords + ns + 2 * ia++;
+                if (entry[1] != count * sizeof(T) || entry[0] % align || entry[0] + entry[1] > size)
+                    throw std::runtime_error("sparse binary: corrupted array table");
+                p = count ? reinterpret_cast<T *>(const_cast<char *>(base + entry[0])) : nullptr;
+            }
+        };
+
+        // replaces the arrays of a matrix by copies
+        struct Copier {
+            template <class T> void scalar(T &) {}
+
+            template <class T> void array(T *&p, uint64_t count) {
+                T *q = fflas_new<T>(count, Alignment::CACHE_LINE);
+                if (count)
+                    std::memcpy(q, p, count * sizeof(T));
+                p = q;
+            }
+        };
+
+        template <class Field, SparseMatrix_t Fmt> inline void check_element() {
+            static_assert(std::is_trivially_copyable<typename Field::Element>::value,
+                          "the binary sparse format needs a machine element type");
+        }
+
+        template <class Field> inline uint64_t characteristic(const Field &F) { return (uint64_t)F.characteristic(); }
+
+        inline uint64_t aligned(const uint64_t x) { return (x + align - 1) / align * align; }
+
+    } // sparse_binary_details
+
+    /// writes A at the current position of os, the offsets of the arrays being relative to it
+    template <class Field, SparseMatrix_t Fmt>
+    inline void sparse_write_binary(const Field &F, const Sparse<Field, Fmt> &A, std::ostream &os) {
+        using namespace sparse_binary_details;
+        check_element<Field, Fmt>();
+        Collector C;
+        visit(A, C, format<Fmt>());
+        const uint64_t ns = C.scalars.size(), na = C.ptrs.size();
+        std::vector<uint64_t> header = {magic,
+                                        version,
+                                        (uint64_t)Fmt,
+                                        sizeof(typename Field::Element),
+                                        sizeof(index_t),
+                                        characteristic(F),
+                                        pack(F.minElement()),
+                                        pack(F.maxElement()),
+                                        ns,
+                                        na};
+        header.insert(header.end(), C.scalars.begin(), C.scalars.end());
+        uint64_t offset = aligned((nwords + ns + 2 * na) * sizeof(uint64_t));
+        for (uint64_t a = 0; a < na; ++a) {
+            header.push_back(offset);
+            header.push_back(C.bytes[a]);
+            offset = aligned(offset + C.bytes[a]);
+        }
+
+        const char zeros[align] = {};
+        uint64_t pos = header.size() * sizeof(uint64_t);
+        os.write(reinterpret_cast<const char *>(header.data()), pos);
+        for (uint64_t a = 0; a < na; ++a) {
+            const uint64_t start = header[nwords + ns + 2 * a];
+            os.write(zeros, start - pos);
+            os.write(C.ptrs[a], C.bytes[a]);
+            pos = start + C.bytes[a];
+        }
+    }
+
+    template <class Field, SparseMatrix_t Fmt>
+    inline void sparse_write_binary(const Field &F, const Sparse<Field, Fmt> &A, const std::string &path) {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("sparse binary: cannot open " + path);
+        sparse_write_binary(F, A, file);
+        if (!file)
+            throw std::runtime_error("sparse binary: cannot write " + path);
+    }
+
+    /** Points the arrays of A into the image of size bytes at base, written
+     * by sparse_write_binary: base must be aligned on a cache line, and must
+     * outlive A. Throws std::runtime_error if the image does not match A and F.
+     */
+    template <class Field, SparseMatrix_t Fmt>
+    inline void sparse_load_binary(const Field &F, Sparse<Field, Fmt> &A, const char *base, const size_t size) {
+        using namespace sparse_binary_details;
+        check_element<Field, Fmt>();
+        const uint64_t *header = reinterpret_cast<const uint64_t *>(base);
+        const char *error = nullptr;
+        if (size < nwords * sizeof(uint64_t) || header[0] != magic)
+            error = "not a binary sparse matrix";
+        else if (header[1] != version)
+            error = "unsupported version";
+        else if (header[2] != (uint64_t)Fmt)
+            error = "wrong sparse format";
+        else if (header[3] != sizeof(typename Field::Element) || header[4] != sizeof(index_t))
+            error = "wrong element or index size";
+        else if (header[5] != characteristic(F))
+            error = "wrong field characteristic";
+        else if (header[6] != pack(F.minElement()) || header[7] != pack(F.maxElement()))
+            error = "wrong field representation";
+        else if ((nwords + header[8] + 2 * header[9]) * sizeof(uint64_t) > size)
+            error = "truncated header";
+        Sparse<Field, Fmt> B;
+        if (error == nullptr) {
+            Loader L(base, size);
+            visit(B, L, format<Fmt>());
+            if (L.is != L.ns || L.ia != L.na)
+                error = "wrong number of fields";
+        }
+        if (error != nullptr)
+            throw std::runtime_error(std::string("sparse binary: ") + error);
+        A = B;
+    }
+
+    /// releases a mapping of sparse_map_binary, and with it the matrix mapped
+    inline void sparse_unmap(SparseMapping &M) {
+#ifdef __FFLASFFPACK_SPARSE_BINARY_MMAP
+        if (M.mapped && M.base != nullptr)
+            munmap(M.base, M.size);
+#endif
+        if (!M.mapped && M.base != nullptr)
+            fflas_delete(M.base);
+        M.base = nullptr;
+        M.size = 0;
+        M.mapped = false;
+    }
+
+    template <class Field, SparseMatrix_t Fmt>
+    inline SparseMapping sparse_map_binary(const Field &F, Sparse<Field, Fmt> &A, const std::string &path) {
+        SparseMapping M;
+#ifdef __FFLASFFPACK_SPARSE_BINARY_MMAP
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("sparse binary: cannot open " + path);
+        struct stat st;
+        if (fstat(fd, &st) < 0) {
+            close(fd);
+            throw std::runtime_error("sparse binary: cannot stat " + path);
+        }
+        M.size = (size_t)st.st_size;
+        if (M.size) {
+            void *p = mmap(nullptr, M.size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (p == MAP_FAILED)
+                throw std::runtime_error("sparse binary: cannot map " + path);
+            M.base = static_cast<char *>(p);
+            M.mapped = true;
+        } else
+            close(fd);
+#else
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error("sparse binary: cannot open " + path);
+        M.size = (size_t)file.tellg();
+        M.base = fflas_new<char>(M.size, Alignment::CACHE_LINE);
+        file.seekg(0);
+        file.read(M.base, M.size);
+#endif
+        try {
+            sparse_load_binary(F, A, M.base, M.size);
+        } catch (const std::runtime_error &e) {
+            sparse_unmap(M);
+            throw std::runtime_error(std::string(e.what()) + " in " + path);
+        }
+        return M;
+    }
+
+    template <class Field, SparseMatrix_t Fmt>
+    inline void sparse_read_binary(const Field &F, Sparse<Field, Fmt> &A, const std::string &path) {
+        using namespace sparse_binary_details;
+        Sparse<Field, Fmt> B;
+        SparseMapping M = sparse_map_binary(F, B, path);
+        Copier C;
+        visit(B, C, format<Fmt>());
+        sparse_unmap(M);
+        A = B;
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_BINARY_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -64,6 +64,8 @@ namespace FFLAS {
 
     template <class Field> struct isSparseMatrix<Field, Sparse<Field, SparseMatrix_t::HYB_ZO>> : public std::true_type {};
 
+    template <class Field> struct isSparseMatrix<Field, Sparse<Field, SparseMatrix_t::AUTO>> : public std::true_type {};
+
 
     template <class F, class M> struct isZOSparseMatrix : public std::false_type {};
 
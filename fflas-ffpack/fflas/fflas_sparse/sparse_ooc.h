@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/sparse_ooc.h
+ * @brief Out-of-core SpMM, streaming the row panels of a matrix from disk.
+ *
+ * sparse_write_panels cuts a matrix, given by its triples sorted by rows,
+ * into panels of consecutive rows of about panelBytes bytes each, and
+ * writes each panel as a binary image of sparse_binary.h. The file starts
+ * with a directory of 64-bit words:
+ *
+ *     magic, version, format, number p of panels, rows, columns, nnz,
+ *     the p+1 first rows of the panels (the last one being the row count),
+ *     the p+1 offsets of the panels in the file (the last one being its size)
+ *
+ * fspmm_ooc computes y <- beta.y + A.x with such a file, keeping only x, y
+ * and two panels in memory: the next panel is read by an asynchronous task
+ * while the current one is multiplied, so that the reads overlap the
+ * computations. x and y must fit in memory, the matrix need not. It
+ * throws std::runtime_error on a corrupted file, y being then partly
+ * updated.
+ *
+ * The panels are stored in any format with an SpMM kernel (CSR by
+ * default): SELL is not supported since it has none.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_OOC_H
+#define __FFLASFFPACK_fflas_sparse_OOC_H
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace FFLAS {
+
+    namespace sparse_ooc_details {
+
+        static const uint64_t magic = 0x4c4e5053414c4646ULL; // "FFLASPNL"
+        static const uint64_t version = 1;
+        static const uint64_t nwords = 7;
+
+        /// directory of a panel file
+        struct Directory {
+            uint64_t format = 0, m = 0, n = 0, nnz = 0;
+            std::vector<uint64_t> rowStart, offset;
+
+            size_t npanels() const { return rowStart.size() - 1; }
+            uint64_t bytes(size_t p) const { return offset[p + 1] - offset[p]; }
+        };
+
+        inline void read_panel(std::istream &is, char *buffer, uint64_t offset, uint64_t bytes) {
+            is.seekg(offset);
+            is.read(buffer, bytes);
+            if (!is)
+                throw std::runtime_error("sparse panels: truncated file");
+        }
+
+        /** Reads the directory at the start of is, checking that the panels
+         * cover the rows 0 to m in order, and lie in order in the file
+         * after the directory.
+         */
+        inline Directory read_directory(std::istream &is) {
+            is.seekg(0, std::ios::end);
+            const uint64_t size = (uint64_t)is.tellg();
+            is.seekg(0);
+            uint64_t header[nwords] = {};
+            is.read(reinterpret_cast<char *>(header), sizeof(header));
+            if (!is || header[0] != magic)
+                throw std::runtime_error("sparse panels: not a panel file");
+            if (header[1] != version)
+                throw std::runtime_error("sparse panels: unsupported version");
+            const uint64_t np = header[3];
+            const uint64_t directory = (nwords + 2 * (np + 1)) * sizeof(uint64_t);
+            if (np > size / (2 * sizeof(uint64_t)) || directory > size)
+                throw std::runtime_error("sparse panels: truncated directory");
+            Directory D;
+            D.format = header[2];
+            D.m = header[4];
+            D.n = header[5];
+            D.nnz = header[6];
+            D.rowStart.resize(np + 1);
+            D.offset.resize(np + 1);
+            is.read(reinterpret_cast<char *>(D.rowStart.data()), D.rowStart.size() * sizeof(uint64_t));
+            is.read(reinterpret_cast<char *>(D.offset.data()), D.offset.size() * sizeof(uint64_t));
+            if (!is)
+                throw std::runtime_error("sparse panels: truncated directory");
+            if (D.rowStart.front() != 0 || D.rowStart.back() != D.m ||
+                !std::is_sorted(D.rowStart.begin(), D.rowStart.end()))
+                throw std::runtime_error("sparse panels: corrupted row starts");
+            if (D.offset.front() < directory || D.offset.back() > size ||
+                !std::is_sorted(D.offset.begin(), D.offset.end()))
+                throw std::runtime_error("sparse panels: corrupted panel offsets");
+            return D;
+        }
+
+    } // sparse_ooc_details
+
+    /** Writes the m x n matrix of the nnz triples (row, col, dat), sorted by
+     * rows, in panels of about panelBytes bytes of format Fmt.
+     * A row is never split: a row larger than panelBytes makes a panel alone.
+     */
+    template <SparseMatrix_t Fmt = SparseMatrix_t::CSR, class Field, class IndexT>
+    inline void sparse_write_panels(const Field &F, const IndexT *row, const IndexT *col,
+                                    typename Field::ConstElement_ptr dat, uint64_t m, uint64_t n, uint64_t nnz,
+                                    uint64_t panelBytes, const std::string &path) {
+        using namespace sparse_ooc_details;
+        const uint64_t perEntry = sizeof(typename Field::Element) + sizeof(index_t);
+
+        // first rows and first entries of the panels
+        std::vector<uint64_t> rowStart(1, 0), entryStart(1, 0);
+        uint64_t bytes = 0;
+        for (uint64_t i = 0, k = 0; i < m; ++i) {
+            const uint64_t k0 = k;
+            while (k < nnz && (uint64_t)row[k] == i)
+                ++k;
+            const uint64_t rowBytes = (k - k0) * perEntry + 2 * sizeof(index_t);
+            if (bytes > 0 && bytes + rowBytes > panelBytes) {
+                rowStart.push_back(i);
+                entryStart.push_back(k0);
+                bytes = 0;
+            }
+            bytes += rowBytes;
+        }
+        if (m > 0) {
+            rowStart.push_back(m);
+            entryStart.push_back(nnz);
+        }
+        if (entryStart.back() != nnz)
+            throw std::runtime_error("sparse panels: the triples are not sorted by rows");
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("sparse panels: cannot open " + path);
+        const size_t np = rowStart.size() - 1;
+        std::vector<uint64_t> offset(np + 1, 0);
+        std::vector<uint64_t> header = {magic, version, (uint64_t)Fmt, np, m, n, nnz};
+        header.insert(header.end(), rowStart.begin(), rowStart.end());
+        const std::streamoff directory = (std::streamoff)(header.size() * sizeof(uint64_t));
+        // the offsets are only known once the panels are written
+        file.seekp(directory + (std::streamoff)(offset.size() * sizeof(uint64_t)));
+
+        std::vector<IndexT> panelRow;
+        for (size_t p = 0; p < np; ++p) {
+            const uint64_t k0 = entryStart[p], nz = entryStart[p + 1] - k0;
+            panelRow.resize(nz);
+            for (uint64_t k = 0; k < nz; ++k)
+                panelRow[k] = (IndexT)(row[k0 + k] - rowStart[p]);
+            Sparse<Field, Fmt> P;
+            sparse_init(F, P, panelRow.data(), col + k0, dat + k0, rowStart[p + 1] - rowStart[p], n, nz);
+            offset[p] = (uint64_t)file.tellp();
+            sparse_write_binary(F, P, file);
+            sparse_delete(P);
+        }
+        offset[np] = (uint64_t)file.tellp();
+
+        file.seekp(0);
+        file.write(reinterpret_cast<const char *>(header.data()), header.size() * sizeof(uint64_t));
+        file.write(reinterpret_cast<const char *>(offset.data()), offset.size() * sizeof(uint64_t));
+        if (!file)
+            throw std::runtime_error("sparse panels: cannot write " + path);
+    }
+
+    /** y <- beta.y + A.x, with A the matrix of the panel file path, written
+     * by sparse_write_panels with the same format Fmt.
+     * x is n x blockSize, y is m x blockSize.
+     */
+    template <SparseMatrix_t Fmt = SparseMatrix_t::CSR, class Field>
+    inline void fspmm_ooc(const Field &F, const std::string &path, size_t blockSize,
+                          typename Field::ConstElement_ptr x, int ldx, const typename Field::Element &beta,
+                          typename Field::Element_ptr y, int ldy) {
+        using namespace sparse_ooc_details;
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if (!file)
+            throw std::runtime_error("sparse panels: cannot open " + path);
+        const Directory D = read_directory(file);
+        if (D.format != (uint64_t)Fmt)
+            throw std::runtime_error("sparse panels: wrong sparse format in " + path);
+
+        if (!F.isOne(beta))
+            fscalin(F, D.m, blockSize, beta, y, ldy);
+        const size_t np = D.npanels();
+        if (np == 0)
+            return;
+
+        uint64_t maxBytes = 0;
+        for (size_t p = 0; p < np; ++p)
+            maxBytes = std::max(maxBytes, D.bytes(p));
+        char *buffer[2] = {fflas_new<char>(maxBytes, Alignment::CACHE_LINE),
+                           fflas_new<char>(maxBytes, Alignment::CACHE_LINE)};
+
+        try {
+            read_panel(file, buffer[0], D.offset[0], D.bytes(0));
+            for (size_t p = 0; p < np; ++p) {
+                // only this task touches the file and the other buffer, until it is waited for
+                std::future<void> next;
+                if (p + 1 < np)
+                    next = std::async(std::launch::async, &read_panel, std::ref(file), buffer[(p + 1) % 2],
+                                      D.offset[p + 1], D.bytes(p + 1));
+                Sparse<Field, Fmt> P;
+                sparse_load_binary(F, P, buffer[p % 2], D.bytes(p));
+                // the future of std::async waits for the read on the way out
+                if ((uint64_t)P.m != D.rowStart[p + 1] - D.rowStart[p] || (uint64_t)P.n != D.n)
+                    throw std::runtime_error("sparse panels: panel of wrong dimensions");
+                fspmm(F, P, blockSize, x, ldx, F.one, y + D.rowStart[p] * (size_t)ldy, ldy);
+                if (next.valid())
+                    next.get();
+            }
+        } catch (const std::runtime_error &e) {
+            fflas_delete(buffer[0]);
+            fflas_delete(buffer[1]);
+            throw std::runtime_error(std::string(e.what()) + " in " + path);
+        } catch (...) {
+            fflas_delete(buffer[0]);
+            fflas_delete(buffer[1]);
+            throw;
+        }
+        fflas_delete(buffer[0]);
+        fflas_delete(buffer[1]);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_OOC_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
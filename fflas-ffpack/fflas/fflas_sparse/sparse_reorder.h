@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file fflas/fflas_sparse/sparse_reorder.h
+ * @brief Sparse matrix stored with a bandwidth reducing reordering.
+ *
+ * SparseReordered<SM> holds a matrix of the format SM whose rows and
+ * columns were renumbered at sparse_init by a reverse Cuthill-McKee
+ * ordering of the bipartite graph of A: the rows come in RCM order, and
+ * the columns are numbered in the order the rows first touch them, so that
+ * neighbouring rows gather from neighbouring entries of x.
+ *
+ * fspmv, fspmm and pfspmv take x and y in the original order: the
+ * permutations are applied to x and y on the fly, through temporaries of
+ * the rows the kernels of SM write (whole chunks for ELL_simd and SELL).
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_REORDER_H
+#define __FFLASFFPACK_fflas_sparse_REORDER_H
+
+namespace FFLAS { /*  Reordered */
+
+    template <class SM> struct SparseReordered {
+        using Field = typename SM::Field;
+        index_t m = 0;
+        index_t n = 0;
+        uint64_t nnz = 0;
+        index_t *rowPerm = nullptr; //!< row i of the input is the output row rowPerm[i] of the kernels of mat
+        index_t *colPerm = nullptr; //!< column j of the input is the column colPerm[j] of mat
+        SM mat;
+    };
+
+    /** Reverse Cuthill-McKee ordering of the bipartite graph of the m x n
+     * matrix with the nnz entries (row, col): sets rowPerm[i] and colPerm[j]
+     * to the new indices of the row i and of the column j.
+     */
+    template <class IndexT>
+    inline void sparse_rcm(const IndexT *row, const IndexT *col, uint64_t rowdim, uint64_t coldim, uint64_t nnz,
+                           index_t *rowPerm, index_t *colPerm);
+
+    template <class Field, class SM, class IndexT>
+    inline void sparse_init(const Field &F, SparseReordered<SM> &A,
+                            const IndexT *row, const IndexT *col,
+                            typename Field::ConstElement_ptr dat, uint64_t rowdim,
+                            uint64_t coldim, uint64_t nnz);
+
+    template <class SM>
+    inline void sparse_delete(const SparseReordered<SM> &A);
+
+    template <class Field, class SM>
+    inline void fspmv(const Field &F, const SparseReordered<SM> &A, typename Field::ConstElement_ptr x,
+                      const typename Field::Element &beta, typename Field::Element_ptr y);
+
+    template <class Field, class SM>
+    inline void fspmm(const Field &F, const SparseReordered<SM> &A, size_t blockSize,
+                      typename Field::ConstElement_ptr x, int ldx, const typename Field::Element &beta,
+                      typename Field::Element_ptr y, int ldy);
+
+#if defined(__FFLASFFPACK_USE_OPENMP)
+    template <class Field, class SM>
+    inline void pfspmv(const Field &F, const SparseReordered<SM> &A, typename Field::ConstElement_ptr x,
+                       const typename Field::Element &beta, typename Field::Element_ptr y);
+#endif
+
+} // FFLAS
+
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_reorder/sparse_reorder_utils.inl"
+#include "fflas-ffpack/fflas/fflas_sparse/sparse_reorder/sparse_reorder_spmv.inl"
+
+#endif // __FFLASFFPACK_fflas_sparse_REORDER_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
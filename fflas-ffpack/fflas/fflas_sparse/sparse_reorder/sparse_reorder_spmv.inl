@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_REORDER_spmv_INL
+#define __FFLASFFPACK_fflas_sparse_REORDER_spmv_INL
+
+namespace FFLAS {
+
+    namespace sparse_reorder_details {
+
+        // B <- the rows of the m x blockSize matrix A, renumbered by perm
+        template <class Field>
+        inline void permute_rows(const Field &F, const index_t *perm, const size_t m, const size_t blockSize,
+                                 typename Field::ConstElement_ptr A, const size_t lda,
+                                 typename Field::Element_ptr B, const size_t ldb) {
+            if (blockSize == 1)
+                for (size_t i = 0; i < m; ++i)
+                    F.assign(B[perm[i] * ldb], A[i * lda]);
+            else
+                for (size_t i = 0; i < m; ++i)
+                    fassign(F, blockSize, A + i * lda, 1, B + perm[i] * ldb, 1);
+        }
+
+        // B <- the rows of A, numbered back by perm
+        template <class Field>
+        inline void unpermute_rows(const Field &F, const index_t *perm, const size_t m, const size_t blockSize,
+                                   typename Field::ConstElement_ptr A, const size_t lda,
+                                   typename Field::Element_ptr B, const size_t ldb) {
+            if (blockSize == 1)
+                for (size_t i = 0; i < m; ++i)
+                    F.assign(B[i * ldb], A[perm[i] * lda]);
+            else
+                for (size_t i = 0; i < m; ++i)
+                    fassign(F, blockSize, A + perm[i] * lda, 1, B + i * ldb, 1);
+        }
+
+        // a zeroed temporary of out_rows(A) rows, holding the rows of y renumbered by rowPerm
+        template <class Field, class SM>
+        inline typename Field::Element_ptr permuted_y(const Field &F, const SparseReordered<SM> &A, size_t blockSize,
+                                                      typename Field::ConstElement_ptr y, int ldy,
+                                                      const typename Field::Element &beta) {
+            const uint64_t rows = out_rows(A.mat);
+            auto yp = fflas_new(F, rows, blockSize, Alignment::CACHE_LINE);
+            fzero(F, rows, blockSize, yp, blockSize);
+            if (!F.isZero(beta))
+                permute_rows(F, A.rowPerm, A.m, blockSize, y, ldy, yp, blockSize);
+            return yp;
+        }
+
+    } // sparse_reorder_details
+
+    template <class Field, class SM>
+    inline void fspmv(const Field &F, const SparseReordered<SM> &A, typename Field::ConstElement_ptr x,
+                      const typename Field::Element &beta, typename Field::Element_ptr y) {
+        auto xp = fflas_new(F, A.n, Alignment::CACHE_LINE);
+        sparse_reorder_details::permute_rows(F, A.colPerm, A.n, 1, x, 1, xp, 1);
+        auto yp = sparse_reorder_details::permuted_y(F, A, 1, y, 1, beta);
+        fspmv(F, A.mat, xp, beta, yp);
+        sparse_reorder_details::unpermute_rows(F, A.rowPerm, A.m, 1, yp, 1, y, 1);
+        fflas_delete(xp);
+        fflas_delete(yp);
+    }
+
+    template <class Field, class SM>
+    inline void fspmm(const Field &F, const SparseReordered<SM> &A, size_t blockSize,
+                      typename Field::ConstElement_ptr x, int ldx, const typename Field::Element &beta,
+                      typename Field::Element_ptr y, int ldy) {
+        auto xp = fflas_new(F, A.n, blockSize, Alignment::CACHE_LINE);
+        sparse_reorder_details::permute_rows(F, A.colPerm, A.n, blockSize, x, ldx, xp, blockSize);
+        auto yp = sparse_reorder_details::permuted_y(F, A, blockSize, y, ldy, beta);
+        fspmm(F, A.mat, blockSize, xp, (int)blockSize, beta, yp, (int)blockSize);
+        sparse_reorder_details::unpermute_rows(F, A.rowPerm, A.m, blockSize, yp, blockSize, y, ldy);
+        fflas_delete(xp);
+        fflas_delete(yp);
+    }
+
+#if defined(__FFLASFFPACK_USE_OPENMP)
+    template <class Field, class SM>
+    inline void pfspmv(const Field &F, const SparseReordered<SM> &A, typename Field::ConstElement_ptr x,
+                       const typename Field::Element &beta, typename Field::Element_ptr y) {
+        auto xp = fflas_new(F, A.n, Alignment::CACHE_LINE);
+        sparse_reorder_details::permute_rows(F, A.colPerm, A.n, 1, x, 1, xp, 1);
+        auto yp = sparse_reorder_details::permuted_y(F, A, 1, y, 1, beta);
+        pfspmv(F, A.mat, xp, beta, yp);
+        sparse_reorder_details::unpermute_rows(F, A.rowPerm, A.m, 1, yp, 1, y, 1);
+        fflas_delete(xp);
+        fflas_delete(yp);
+    }
+#endif // __FFLASFFPACK_USE_OPENMP
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_REORDER_spmv_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
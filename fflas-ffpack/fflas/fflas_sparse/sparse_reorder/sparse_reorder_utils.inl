@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFLASFFPACK_fflas_sparse_REORDER_utils_INL
+#define __FFLASFFPACK_fflas_sparse_REORDER_utils_INL
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace FFLAS {
+
+    namespace sparse_reorder_details {
+
+        // rows written by the kernels of A: ELL_simd and SELL write whole chunks
+        template <class SM> inline uint64_t out_rows(const SM &A) { return A.m; }
+
+        template <class Field> inline uint64_t out_rows(const Sparse<Field, SparseMatrix_t::ELL_simd> &A) {
+            return A.nChunks * A.chunk;
+        }
+
+        template <class Field> inline uint64_t out_rows(const Sparse<Field, SparseMatrix_t::ELL_simd_ZO> &A) {
+            return A.nChunks * A.chunk;
+        }
+
+        template <class Field> inline uint64_t out_rows(const Sparse<Field, SparseMatrix_t::SELL> &A) {
+            return A.nChunks * A.chunk;
+        }
+
+        template <class Field> inline uint64_t out_rows(const Sparse<Field, SparseMatrix_t::SELL_ZO> &A) {
+            return A.nChunks * A.chunk;
+        }
+
+        // output row of the kernels of A holding the row i of A: SELL stores its rows sorted
+        template <class SM> inline index_t out_row(const SM &A, index_t i) { return i; }
+
+        template <class Field> inline index_t out_row(const Sparse<Field, SparseMatrix_t::SELL> &A, index_t i) {
+            return A.perm[i];
+        }
+
+        template <class Field> inline index_t out_row(const Sparse<Field, SparseMatrix_t::SELL_ZO> &A, index_t i) {
+            return A.perm[i];
+        }
+
+    } // sparse_reorder_details
+
+    template <class IndexT>
+    inline void sparse_rcm(const IndexT *row, const IndexT *col, uint64_t rowdim, uint64_t coldim, uint64_t nnz,
+                           index_t *rowPerm, index_t *colPerm) {
+        // adjacency lists of the rows and of the columns
+        std::vector<uint64_t> rst(rowdim + 1, 0), cst(coldim + 1, 0);
+        for (uint64_t k = 0; k < nnz; ++k) {
+            rst[row[k] + 1]++;
+            cst[col[k] + 1]++;
+        }
+        for (uint64_t i = 0; i < rowdim; ++i)
+            rst[i + 1] += rst[i];
+        for (uint64_t j = 0; j < coldim; ++j)
+            cst[j + 1] += cst[j];
+        std::vector<index_t> radj(nnz), cadj(nnz);
+        {
+            std::vector<uint64_t> rpos(rst.begin(), rst.end() - 1), cpos(cst.begin(), cst.end() - 1);
+            for (uint64_t k = 0; k < nnz; ++k) {
+                radj[rpos[row[k]]++] = (index_t)col[k];
+                cadj[cpos[col[k]]++] = (index_t)row[k];
+            }
+        }
+        auto rdeg = [&rst](index_t i) { return rst[i + 1] - rst[i]; };
+        auto cdeg = [&cst](index_t j) { return cst[j + 1] - cst[j]; };
+
+        // Cuthill-McKee: breadth first search of each component from a row of
+        // minimal degree, the neighbours being visited by increasing degrees.
+        // The columns are numbered as the rows first reach them.
+        std::vector<index_t> rorder, corder, nbr;
+        rorder.reserve(rowdim);
+        corder.reserve(coldim);
+        std::vector<char> rseen(rowdim, 0), cseen(coldim, 0);
+        std::vector<index_t> starts(rowdim);
+        std::iota(starts.begin(), starts.end(), 0);
+        std::stable_sort(starts.begin(), starts.end(), [&rdeg](index_t a, index_t b) { return rdeg(a) < rdeg(b); });
+        size_t head = 0;
+        for (auto s : starts) {
+            if (rseen[s])
+                continue;
+            rseen[s] = 1;
+            rorder.push_back(s);
+            while (head < rorder.size()) {
+                const index_t i = rorder[head++];
+                nbr.clear();
+                for (uint64_t k = rst[i]; k < rst[i + 1]; ++k) {
+                    const index_t j = radj[k];
+                    if (!cseen[j]) {
+                        cseen[j] = 1;
+                        nbr.push_back(j);
+                    }
+                }
+                std::stable_sort(nbr.begin(), nbr.end(), [&cdeg](index_t a, index_t b) { return cdeg(a) < cdeg(b); });
+                for (auto j : nbr) {
+                    corder.push_back(j);
+                    const size_t first = rorder.size();
+                    for (uint64_t k = cst[j]; k < cst[j + 1]; ++k) {
+                        const index_t r = cadj[k];
+                        if (!rseen[r]) {
+                            rseen[r] = 1;
+                            rorder.push_back(r);
+                        }
+                    }
+                    std::stable_sort(rorder.begin() + first, rorder.end(),
+                                     [&rdeg](index_t a, index_t b) { return rdeg(a) < rdeg(b); });
+                }
+            }
+        }
+        // empty columns
+        for (uint64_t j = 0; j < coldim; ++j)
+            if (!cseen[j])
+                corder.push_back((index_t)j);
+
+        // reversed
+        for (uint64_t k = 0; k < rowdim; ++k)
+            rowPerm[rorder[k]] = (index_t)(rowdim - 1 - k);
+        for (uint64_t k = 0; k < coldim; ++k)
+            colPerm[corder[k]] = (index_t)(coldim - 1 - k);
+    }
+
+    template <class Field, class SM, class IndexT>
+    inline void sparse_init(const Field &F, SparseReordered<SM> &A, const IndexT *row, const IndexT *col,
+                            typename Field::ConstElement_ptr dat, uint64_t rowdim, uint64_t coldim, uint64_t nnz) {
+        A.m = rowdim;
+        A.n = coldim;
+        A.nnz = nnz;
+        A.rowPerm = fflas_new<index_t>(rowdim, Alignment::CACHE_LINE);
+        A.colPerm = fflas_new<index_t>(coldim, Alignment::CACHE_LINE);
+        sparse_rcm(row, col, rowdim, coldim, nnz, A.rowPerm, A.colPerm);
+
+        // the renumbered entries, sorted by rows as sparse_init expects
+        std::vector<uint64_t> idx(nnz);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(), [&A, row, col](uint64_t a, uint64_t b) {
+                  const index_t ra = A.rowPerm[row[a]], rb = A.rowPerm[row[b]];
+                  return (ra < rb) || (ra == rb && A.colPerm[col[a]] < A.colPerm[col[b]]);
+                  });
+        index_t *row2 = fflas_new<index_t>(nnz, Alignment::CACHE_LINE);
+        index_t *col2 = fflas_new<index_t>(nnz, Alignment::CACHE_LINE);
+        typename Field::Element_ptr dat2 = fflas_new(F, nnz, Alignment::CACHE_LINE);
+        for (uint64_t k = 0; k < nnz; ++k) {
+            row2[k] = A.rowPerm[row[idx[k]]];
+            col2[k] = A.colPerm[col[idx[k]]];
+            F.assign(dat2[k], dat[idx[k]]);
+        }
+        sparse_init(F, A.mat, row2, col2, dat2, rowdim, coldim, nnz);
+        // the rows of y then go straight to the output rows of A.mat
+        for (uint64_t i = 0; i < rowdim; ++i)
+            A.rowPerm[i] = sparse_reorder_details::out_row(A.mat, A.rowPerm[i]);
+        fflas_delete(row2);
+        fflas_delete(col2);
+        fflas_delete(dat2);
+    }
+
+    template <class SM> inline void sparse_delete(const SparseReordered<SM> &A) {
+        fflas_delete(A.rowPerm);
+        fflas_delete(A.colPerm);
+        sparse_delete(A.mat);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_fflas_sparse_REORDER_utils_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
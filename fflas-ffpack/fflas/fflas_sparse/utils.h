@@ -68,6 +68,15 @@ namespace FFLAS{
         std::vector<uint64_t> denseCols;
     };
 
+    /// largest number of entries of a column, bounding the accumulations of the transposed products
+    template <class IndexT>
+    inline uint64_t maxColCount(const IndexT *col, uint64_t coldim, uint64_t nnz) {
+        std::vector<uint64_t> cols(coldim, 0);
+        for (uint64_t i = 0; i < nnz; ++i)
+            cols[col[i]]++;
+        return coldim ? *(std::max_element(cols.begin(), cols.end())) : 0;
+    }
+
     template <class It> double computeDeviation(It begin, It end) {
         using T = typename std::decay<decltype(*begin)>::type;
         T average = 0;
@@ -443,7 +443,7 @@ namespace FFPACK { /* ftrtr */
     void
     ftrtri (const Field& F, const FFLAS::FFLAS_UPLO Uplo, const FFLAS::FFLAS_DIAG Diag,
             const size_t N, typename Field::Element_ptr A, const size_t lda,
-            const size_t threshold = __FFLASFFPACK_FTRTRI_THRESHOLD);
+            const size_t threshold = FFLAS::tuning().FtrtriThreshold);
 
 
     template<class Field>
@@ -529,19 +529,19 @@ namespace FFPACK {
     template <class Field>
     bool fsytrf (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                  typename Field::Element_ptr A, const size_t lda,
-                 const size_t threshold = __FFLASFFPACK_FSYTRF_THRESHOLD);
+                 const size_t threshold = FFLAS::tuning().FsytrfThreshold);
 
     template <class Field>
     bool fsytrf (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                  typename Field::Element_ptr A, const size_t lda,
                  const FFLAS::ParSeqHelper::Sequential seq,
-                 const size_t threshold = __FFLASFFPACK_FSYTRF_THRESHOLD);
+                 const size_t threshold = FFLAS::tuning().FsytrfThreshold);
 
     template <class Field, class Cut, class Param>
     bool fsytrf (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                  typename Field::Element_ptr A, const size_t lda,
                  const FFLAS::ParSeqHelper::Parallel<Cut,Param> par,
-                 const size_t threshold = __FFLASFFPACK_FSYTRF_THRESHOLD);
+                 const size_t threshold = FFLAS::tuning().FsytrfThreshold);
 
     /* LDLT or UTDU factorizations */
 
@@ -565,7 +565,7 @@ namespace FFPACK {
     bool fsytrf_nonunit (const Field& F, const FFLAS::FFLAS_UPLO UpLo, const size_t N,
                          typename Field::Element_ptr A, const size_t lda,
                          typename Field::Element_ptr D, const size_t incD,
-                         const size_t threshold = __FFLASFFPACK_FSYTRF_THRESHOLD);
+                         const size_t threshold = FFLAS::tuning().FsytrfThreshold);
     /* PLUQ */
 
     /** @brief Compute a PLUQ factorization of the given matrix.
@@ -603,7 +603,7 @@ namespace FFPACK {
                  const size_t M, const size_t N,
                  typename Field::Element_ptr A, const size_t lda,
                  size_t*P, size_t *Q, const FFLAS::ParSeqHelper::Sequential& PSHelper,
-                 size_t BCThreshold = __FFLASFFPACK_PLUQ_THRESHOLD);
+                 size_t BCThreshold = FFLAS::tuning().PluqThreshold);
 
     template<class Field, class Cut, class Param>
     size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
@@ -611,6 +611,23 @@ namespace FFPACK {
                  typename Field::Element_ptr A, const size_t lda,
                  size_t*P, size_t *Q, const FFLAS::ParSeqHelper::Parallel<Cut,Param>& PSHelper);
 
+    /** @brief Tiled parallel PLUQ factorization, with panel lookahead.
+     * A is cut into column tiles of width \p TileSize. Each panel is factored by
+     * the sequential PLUQ and triggers the updates of the tiles on its right
+     * as independent tasks. The update and factorization of the next panel
+     * form a single task, issued first, so that it overlaps the remaining
+     * updates of the current step. Must be called inside a PAR_BLOCK.
+     * @param TileSize width of the column tiles
+     */
+    template<class Field>
+    size_t PLUQ (const Field& F, const FFLAS::FFLAS_DIAG Diag,
+                 const size_t M, const size_t N,
+                 typename Field::Element_ptr A, const size_t lda,
+                 size_t*P, size_t *Q,
+                 const FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Column,
+                                                     FFLAS::StrategyParameter::Threads>& PSHelper,
+                 const size_t TileSize = FFLAS::tuning().PluqTileSize);
+
 } // FFPACK PLUQ
 // #include "ffpack_pluq.inl"
 
@@ -650,6 +667,18 @@ namespace FFPACK { /* ludivine */
               const FFPACK_LU_TAG LuTag = FfpackSlabRecursive,
               const size_t cutoff=__FFLASFFPACK_LUDIVINE_THRESHOLD);
 
+    /** @brief LUdivine with its triangular solves and updates run along a ParSeqHelper.
+     * The slab recursion and the pivoting, hence the CUP decomposition, are those of the
+     * sequential LUdivine. With a parallel helper, must be called inside a PAR_BLOCK.
+     */
+    template <class Field, class PSHelper>
+    size_t
+    LUdivine (const Field& F, const FFLAS::FFLAS_DIAG Diag,  const FFLAS::FFLAS_TRANSPOSE trans,
+              const size_t M, const size_t N,
+              typename Field::Element_ptr A, const size_t lda,
+              size_t* P, size_t* Qt,
+              const FFPACK_LU_TAG LuTag, const size_t cutoff, const PSHelper& psH);
+
     /* \cond */
     template<class Element>
     class callLUdivine_small;
@@ -702,6 +731,18 @@ namespace FFPACK { /* ludivine */
                             , const size_t kg_mb =0
                             , const size_t kg_j  =0);
 
+        // Same, with the Krylov iterates and the updates computed along psH
+        template <class Field, class PSHelper>
+        size_t
+        LUdivine_construct( const Field& F, const FFLAS::FFLAS_DIAG Diag,
+                            const size_t M, const size_t N,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::Element_ptr X, const size_t ldx,
+                            typename Field::Element_ptr u, const size_t incu, size_t* P,
+                            bool computeX, const FFPACK_MINPOLY_TAG MinTag,
+                            const size_t kg_mc, const size_t kg_mb, const size_t kg_j,
+                            const PSHelper& psH);
+
     } // Protected
 
 } //FFPACK ludivine, turbo
@@ -1004,7 +1045,7 @@ namespace FFPACK { /* charpoly */
               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
               typename PolRing::Domain_t::RandIter& G,
               const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
-              const size_t degree = __FFLASFFPACK_ARITHPROG_THRESHOLD);
+              const size_t degree = FFLAS::tuning().ArithProgThreshold);
 
     /**
      * @brief Compute the characteristic polynomial of the matrix A.
@@ -1022,7 +1063,7 @@ namespace FFPACK { /* charpoly */
               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
               typename PolRing::Domain_t::RandIter& G,
               const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
-              const size_t degree = __FFLASFFPACK_ARITHPROG_THRESHOLD);
+              const size_t degree = FFLAS::tuning().ArithProgThreshold);
 
     /**
      * @brief Compute the characteristic polynomial of the matrix A.
@@ -1038,11 +1079,46 @@ namespace FFPACK { /* charpoly */
     CharPoly (const PolRing& R, typename PolRing::Element& charp, const size_t N,
               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
               const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
-              const size_t degree = __FFLASFFPACK_ARITHPROG_THRESHOLD){
+              const size_t degree = FFLAS::tuning().ArithProgThreshold){
         typename PolRing::Domain_t::RandIter G(R.getdomain());
         return CharPoly (R, charp, N, A, lda, G, CharpTag, degree);
     }
 
+    /**
+     * @brief Compute the characteristic polynomial of the matrix A, along a ParSeqHelper.
+     * With a parallel helper, the Krylov iterations, the eliminations and the similarity
+     * transformations of the LUKrylov and ArithProg variants run on its threads; the other
+     * variants are sequential. With a parallel helper, must be called inside a PAR_BLOCK.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     */
+    template <class PolRing, class PSHelper>
+    inline std::list<typename PolRing::Element>&
+    CharPoly (const PolRing& R, std::list<typename PolRing::Element>& charp, const size_t N,
+              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+              typename PolRing::Domain_t::RandIter& G, const PSHelper& psH,
+              const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
+              const size_t degree = FFLAS::tuning().ArithProgThreshold);
+
+    template <class PolRing, class PSHelper>
+    inline typename PolRing::Element&
+    CharPoly (const PolRing& R, typename PolRing::Element& charp, const size_t N,
+              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+              typename PolRing::Domain_t::RandIter& G, const PSHelper& psH,
+              const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
+              const size_t degree = FFLAS::tuning().ArithProgThreshold);
+
+    /**
+     * @brief Compute the characteristic polynomial of the matrix A on \p numthreads threads.
+     * @param numthreads the number of threads (0 for NUM_THREADS)
+     */
+    template <class PolRing>
+    inline typename PolRing::Element&
+    pCharPoly (const PolRing& R, typename PolRing::Element& charp, const size_t N,
+               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+               typename PolRing::Domain_t::RandIter& G, size_t numthreads = 0,
+               const FFPACK_CHARPOLY_TAG CharpTag= FfpackAuto,
+               const size_t degree = FFLAS::tuning().ArithProgThreshold);
+
 
     namespace Protected {
         template <class Field, class Polynomial>
@@ -1071,11 +1147,12 @@ namespace FFPACK { /* charpoly */
                    typename Field::Element_ptr Y, const size_t incY,
                    const size_t kg_mc, const size_t kg_mb, const size_t kg_j );
 
-        template <class Field, class Polynomial, class RandIter>
+        template <class Field, class Polynomial, class RandIter, class PSHelper>
         std::list<Polynomial>&
         LUKrylov( const Field& F, std::list<Polynomial>& charp, const size_t N,
                   typename Field::Element_ptr A, const size_t lda,
-                  typename Field::Element_ptr U, const size_t ldu, RandIter& G);
+                  typename Field::Element_ptr U, const size_t ldu, RandIter& G,
+                  const PSHelper& psH);
 
         template <class Field, class Polynomial>
         std::list<Polynomial>&
@@ -1083,18 +1160,19 @@ namespace FFPACK { /* charpoly */
                     const size_t N, typename Field::Element_ptr A, const size_t lda);
 
 
-        template <class PolRing>
+        template <class PolRing, class PSHelper>
         inline void
         RandomKrylovPrecond (const PolRing& PR, std::list<typename PolRing::Element>& completedFactors, const size_t N,
                              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
                              size_t& Nb, typename PolRing::Domain_t::Element_ptr& B, size_t& ldb,
-                             typename PolRing::Domain_t::RandIter& g, const size_t degree=__FFLASFFPACK_ARITHPROG_THRESHOLD);
+                             typename PolRing::Domain_t::RandIter& g, const size_t degree,
+                             const PSHelper& psH);
         
-        template <class PolRing>
+        template <class PolRing, class PSHelper>
         inline std::list<typename PolRing::Element>&
         ArithProg (const PolRing& PR, std::list<typename PolRing::Element>& frobeniusForm,
                    const size_t N, typename PolRing::Domain_t::Element_ptr A, const size_t lda,
-                   const size_t degree);
+                   const size_t degree, const PSHelper& psH);
 
         template <class Field, class Polynomial>
         std::list<Polynomial>&
@@ -1153,6 +1231,28 @@ namespace FFPACK { /* minpoly */
     MinPoly (const Field& F, Polynomial& minP, const size_t N,
              typename Field::ConstElement_ptr A, const size_t lda, RandIter& G);
 
+    /**
+     * @brief Compute the minimal polynomial of the matrix A, along a ParSeqHelper.
+     * With a parallel helper, the Krylov iterates and the online elimination run on its
+     * threads, and the call must be inside a PAR_BLOCK.
+     * @param psH a ParSeqHelper to choose between sequential and parallel execution
+     */
+    template <class Field, class Polynomial, class RandIter, class PSHelper>
+    Polynomial&
+    MinPoly (const Field& F, Polynomial& minP, const size_t N,
+             typename Field::ConstElement_ptr A, const size_t lda, RandIter& G,
+             const PSHelper& psH);
+
+    /**
+     * @brief Compute the minimal polynomial of the matrix A on \p numthreads threads.
+     * @param numthreads the number of threads (0 for NUM_THREADS)
+     */
+    template <class Field, class Polynomial, class RandIter>
+    Polynomial&
+    pMinPoly (const Field& F, Polynomial& minP, const size_t N,
+              typename Field::ConstElement_ptr A, const size_t lda, RandIter& G,
+              size_t numthreads = 0);
+
     /**
      * @brief Compute the minimal polynomial of the matrix A and a vector v, namely the first linear dependency relation in the Krylov basis \f$(v,Av, ..., A^Nv)\f$.
      * @param F the base field
@@ -1170,14 +1270,21 @@ namespace FFPACK { /* minpoly */
                    typename Field::ConstElement_ptr A, const size_t lda,
                    typename Field::ConstElement_ptr v, const size_t incv);
 
+    template <class Field, class Polynomial, class PSHelper>
+    Polynomial&
+    MatVecMinPoly (const Field& F, Polynomial& minP, const size_t N,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::ConstElement_ptr v, const size_t incv,
+                   const PSHelper& psH);
+
     namespace Protected{
-        template <class Field, class Polynomial>
+        template <class Field, class Polynomial, class PSHelper>
         Polynomial&
         MatVecMinPoly (const Field& F, Polynomial& minP, const size_t N,
                        typename Field::ConstElement_ptr A, const size_t lda,
                        typename Field::Element_ptr v, const size_t incv,
                        typename Field::Element_ptr K, const size_t ldk,
-                       size_t * P);
+                       size_t * P, const PSHelper& psH);
 
         template <class Field, class Polynomial>
         Polynomial&
@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file ffpack/ffpack_bitsliced.inl
+ * @brief PLUQ and its applications over the bit-sliced GF(2) and GF(3).
+ *
+ * The elimination is that of M4RI: the pivots are searched by groups of
+ * Words::grease in a window of 64 columns, where the group is applied
+ * right away, and the rest of the rows is then updated once, by the table
+ * of the linear combinations of the pivot rows of the group.
+ */
+
+#ifndef __FFLASFFPACK_ffpack_bitsliced_INL
+#define __FFLASFFPACK_ffpack_bitsliced_INL
+
+#include <vector>
+
+#include "fflas-ffpack/ffpack/ffpack.h"
+
+namespace FFPACK { namespace Protected {
+
+    //! Swaps the n entries of the rows starting at a and b, through tmp
+    template<uint64_t Q>
+    inline void bs_swaprows (const BitSliced<Q>& F, const size_t n,
+                             typename BitSliced<Q>::Element_ptr a, typename BitSliced<Q>::Element_ptr b, uint64_t* tmp)
+    {
+        using FFLAS::details::bs_rowop;
+        const FFLAS::details::bs_axpby<Q> copy (1, 0);
+        typename BitSliced<Q>::Element_ptr t (tmp);
+        bs_rowop (t, a, n, copy);
+        bs_rowop (a, b, n, copy);
+        bs_rowop (b, t, n, copy);
+    }
+
+    /** \brief PLUQ of the bit-sliced M x N matrix A, with the same output as FFPACK::PLUQ.
+     *
+     * The permutations are the sequences of transpositions of LAPACK; the
+     * pivots are found in column order, and the rows are swapped as a whole.
+     */
+    template<uint64_t Q>
+    inline size_t PLUQ_bitsliced (const BitSliced<Q>& F, const FFLAS::FFLAS_DIAG Diag,
+                                  const size_t M, const size_t N,
+                                  typename BitSliced<Q>::Element_ptr A, const size_t lda,
+                                  size_t* P, size_t* Qt)
+    {
+        typedef BitSliced<Q> Field;
+        typedef typename Field::Words Words;
+        typedef typename Field::Element Element;
+        typedef typename Field::Element_ptr Element_ptr;
+        using FFLAS::details::bs_rowop;
+        using FFLAS::details::bs_load;
+        typedef FFLAS::details::bs_axpby<Q> axpby;
+        const size_t PL = Field::planes, K = Field::grease;
+
+        for (size_t i = 0; i < M; ++i) P[i] = i;
+        for (size_t j = 0; j < N; ++j) Qt[j] = j;
+        if (!M || !N) return 0;
+
+        size_t pw[9];
+        pw[0] = 1;
+        for (size_t t = 1; t <= K; ++t) pw[t] = Q*pw[t-1];
+        const size_t rw = PL * FFLAS::bitsliced_groups (N);
+        std::vector<uint64_t> win (M*PL);
+        std::vector<size_t> code (M);
+        uint64_t* tmp = FFLAS::fflas_new<uint64_t> (rw, Alignment::CACHE_LINE);
+        uint64_t* Tab = FFLAS::fflas_new<uint64_t> (pw[K]*rw, Alignment::CACHE_LINE);
+        Element u[8], f, c;
+
+        size_t r = 0, s = 0;
+        while (r < M && s < N) {
+            // the window of 64 columns from s, in the rows without pivot
+            const size_t wl = std::min (size_t(64), N - s);
+            for (size_t i = r; i < M; ++i) {
+                bs_load (&win[i*PL], A + i*lda + s, wl);
+                code[i] = 0;
+            }
+            size_t g = 0, j = 0;
+            for (; j < wl && g < K; ++j) {
+                const size_t rp = r + g;
+                size_t i = rp;
+                while (i < M && F.isZero (Words::get (&win[i*PL], j))) ++i;
+                if (i == M) continue;
+                P[rp] = i;
+                if (i != rp) {
+                    bs_swaprows (F, N, A + i*lda, A + rp*lda, tmp);
+                    for (size_t p = 0; p < PL; ++p) std::swap (win[i*PL+p], win[rp*PL+p]);
+                    std::swap (code[i], code[rp]);
+                }
+                // the columns in [rp, s+j) have no pivot left: the entries of the window before j are not read again
+                Qt[rp] = s + j;
+                if (s + j != rp)
+                    for (size_t ii = 0; ii < M; ++ii) {
+                        const Element x = A[ii*lda + s + j];
+                        A[ii*lda + s + j] = A[ii*lda + rp];
+                        A[ii*lda + rp] = x;
+                    }
+                u[g] = Words::get (&win[rp*PL], j);
+                Element uinv;
+                F.inv (uinv, u[g]);
+                const uint64_t after = (j == 63) ? 0 : ~((UINT64_C(2) << j) - 1);
+                for (size_t ii = rp+1; ii < M; ++ii) {
+                    c = Words::get (&win[ii*PL], j);
+                    if (F.isZero (c)) continue;
+                    F.mul (f, c, uinv);
+                    code[ii] += f * pw[g];
+                    uint64_t t[PL];
+                    for (size_t p = 0; p < PL; ++p) t[p] = win[ii*PL+p];
+                    Words::axpyin (t, F.negin (f), &win[rp*PL]);
+                    Words::select (&win[ii*PL], t, after);
+                }
+                ++g;
+            }
+
+            // the pivot rows, restricted to the columns after their pivots, eliminate the next pivot rows
+            for (size_t t = 1; t < g; ++t)
+                for (size_t t2 = 0; t2 < t; ++t2) {
+                    f = Element((code[r+t] / pw[t2]) % Q);
+                    if (!F.isZero (f))
+                        bs_rowop (A + (r+t)*lda + r+t2+1, A + (r+t2)*lda + r+t2+1, N-(r+t2+1), axpby (F.negin (f), 1));
+                }
+            // then the other rows, by the table of their combinations on the columns from r
+            if (g && r + g < M) {
+                const size_t nc = N - r, tw = PL * FFLAS::bitsliced_groups (nc);
+                std::fill (Tab, Tab + tw, UINT64_C(0));
+                for (size_t t = 0; t < g; ++t) {
+                    uint64_t* Tt = Tab + pw[t]*tw;
+                    bs_rowop (Element_ptr (Tt), A + (r+t)*lda + r, nc, axpby (1, 0));
+                    for (size_t b = 0; b <= t; ++b) Words::set (Tt, b, 0);
+                }
+                for (size_t x = 2; x < pw[g]; ++x) {
+                    size_t t = 0;
+                    while ((x / pw[t]) % Q == 0) ++t;
+                    const Element d = Element((x / pw[t]) % Q);
+                    if (d == 1 && x == pw[t]) continue;
+                    uint64_t* Tx = Tab + x*tw;
+                    const uint64_t* Ty = Tab + (x - d*pw[t])*tw;
+                    const uint64_t* Tr = Tab + pw[t]*tw;
+                    for (size_t w = 0; w < tw; w += PL) {
+                        for (size_t p = 0; p < PL; ++p) Tx[w+p] = Ty[w+p];
+                        Words::axpyin (Tx+w, d, Tr+w);
+                    }
+                }
+                for (size_t i = r+g; i < M; ++i)
+                    if (code[i])
+                        bs_rowop (A + i*lda + r, Element_ptr (Tab + code[i]*tw), nc, axpby (F.mOne, 1));
+            }
+            // the multipliers, stored in L
+            for (size_t i = r+1; i < M; ++i)
+                for (size_t t = 0; t < std::min (g, i-r); ++t) {
+                    f = Element((code[i] / pw[t]) % Q);
+                    if (Diag == FFLAS::FflasUnit) F.mulin (f, u[t]);
+                    A[i*lda + r+t] = f;
+                }
+            if (Diag == FFLAS::FflasUnit)
+                for (size_t t = 0; t < g; ++t)
+                    if (!F.isOne (u[t]))
+                        bs_rowop (A + (r+t)*lda + r+t+1, A + (r+t)*lda + r+t+1, N-(r+t+1), axpby (0, F.inv (f, u[t])));
+            r += g;
+            s += j;
+        }
+        FFLAS::fflas_delete (tmp, Tab);
+        return r;
+    }
+
+    template<uint64_t Q>
+    inline typename BitSliced<Q>::Element&
+    Det_bitsliced (const BitSliced<Q>& F, typename BitSliced<Q>::Element& det, const size_t N,
+                   typename BitSliced<Q>::Element_ptr A, const size_t lda, size_t* P, size_t* Qt)
+    {
+        const bool allocP = (P == NULL), allocQ = (Qt == NULL);
+        if (allocP) P = FFLAS::fflas_new<size_t> (N);
+        if (allocQ) Qt = FFLAS::fflas_new<size_t> (N);
+        if (PLUQ_bitsliced (F, FFLAS::FflasNonUnit, N, N, A, lda, P, Qt) < N)
+            F.assign (det, F.zero);
+        else {
+            F.assign (det, F.one);
+            for (size_t i = 0; i < N; ++i) {
+                F.mulin (det, A[i*lda+i]);
+                if (P[i] != i) F.negin (det);
+                if (Qt[i] != i) F.negin (det);
+            }
+        }
+        if (allocP) FFLAS::fflas_delete (P);
+        if (allocQ) FFLAS::fflas_delete (Qt);
+        return det;
+    }
+
+    /** As the TileRecursive echelon forms of FFPACK. The transformation is built
+     * by the bit-sliced ftrsm and fgemm: L1^-1 is solved from the identity, the
+     * rows below become -L2.L1^-1, and the reduced form stores U1^-1.L1^-1.
+     */
+    template<uint64_t Q>
+    inline size_t RowEchelonForm_bitsliced (const BitSliced<Q>& F, const size_t M, const size_t N,
+                                            typename BitSliced<Q>::Element_ptr A, const size_t lda,
+                                            size_t* P, size_t* Qt, const bool transform, const bool reduced)
+    {
+        typedef typename BitSliced<Q>::Element_ptr Element_ptr;
+        using FFLAS::details::ftrsm_bitsliced;
+        const size_t r = PLUQ_bitsliced (F, FFLAS::FflasUnit, M, N, A, lda, P, Qt);
+        if (reduced)
+            ftrsm_bitsliced (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit,
+                             r, N-r, F.one, A, lda, A+r, lda);
+        if (!transform || !r) return r;
+
+        const size_t ldt = FFLAS::bitsliced_groups (r) << 6;
+        Element_ptr T = FFLAS::fflas_new (F, r, r);
+        for (size_t i = 0; i < r; ++i) T[i*ldt+i] = F.one;
+        ftrsm_bitsliced (F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit,
+                         r, r, F.one, A, lda, T, ldt);
+        ftrsm_bitsliced (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit,
+                         M-r, r, F.mOne, A, lda, A+r*lda, lda);
+        if (reduced) {
+            // the strictly upper part of A, U1, is not needed any more
+            Element_ptr V = FFLAS::fflas_new (F, r, r);
+            for (size_t i = 0; i < r; ++i) V[i*ldt+i] = F.one;
+            ftrsm_bitsliced (F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasUnit,
+                             r, r, F.one, A, lda, V, ldt);
+            FFLAS::details::fgemm_bitsliced (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, r, r,
+                                             F.one, V, ldt, T, ldt, F.zero, A, lda);
+            FFLAS::fflas_delete (V);
+        } else
+            for (size_t i = 0; i < r; ++i)
+                for (size_t j = 0; j <= i; ++j)
+                    A[i*lda+j] = T[i*ldt+j];
+        FFLAS::fflas_delete (T);
+        return r;
+    }
+
+} // Protected
+} // FFPACK
+
+namespace FFPACK {
+
+    template<uint64_t Q>
+    inline size_t PLUQ (const BitSliced<Q>& F, const FFLAS::FFLAS_DIAG Diag,
+                        const size_t M, const size_t N,
+                        typename BitSliced<Q>::Element_ptr A, const size_t lda,
+                        size_t* P, size_t* Qt)
+    {
+        return Protected::PLUQ_bitsliced (F, Diag, M, N, A, lda, P, Qt);
+    }
+
+    template<uint64_t Q>
+    inline size_t Rank (const BitSliced<Q>& F, const size_t M, const size_t N,
+                        typename BitSliced<Q>::Element_ptr A, const size_t lda)
+    {
+        std::vector<size_t> P (M), Qt (N);
+        return Protected::PLUQ_bitsliced (F, FFLAS::FflasNonUnit, M, N, A, lda, P.data(), Qt.data());
+    }
+
+    template<uint64_t Q>
+    inline typename BitSliced<Q>::Element&
+    Det (const BitSliced<Q>& F, typename BitSliced<Q>::Element& det, const size_t N,
+         typename BitSliced<Q>::Element_ptr A, const size_t lda,
+         size_t* P = NULL, size_t* Qt = NULL)
+    {
+        return Protected::Det_bitsliced (F, det, N, A, lda, P, Qt);
+    }
+
+    //! LuTag is ignored: the echelon forms are those of FfpackTileRecursive
+    template<uint64_t Q>
+    inline size_t RowEchelonForm (const BitSliced<Q>& F, const size_t M, const size_t N,
+                                  typename BitSliced<Q>::Element_ptr A, const size_t lda,
+                                  size_t* P, size_t* Qt, const bool transform = false,
+                                  const FFPACK_LU_TAG LuTag = FfpackSlabRecursive)
+    {
+        return Protected::RowEchelonForm_bitsliced (F, M, N, A, lda, P, Qt, transform, false);
+    }
+
+    template<uint64_t Q>
+    inline size_t ReducedRowEchelonForm (const BitSliced<Q>& F, const size_t M, const size_t N,
+                                         typename BitSliced<Q>::Element_ptr A, const size_t lda,
+                                         size_t* P, size_t* Qt, const bool transform = false,
+                                         const FFPACK_LU_TAG LuTag = FfpackSlabRecursive)
+    {
+        return Protected::RowEchelonForm_bitsliced (F, M, N, A, lda, P, Qt, transform, true);
+    }
+
+} // FFPACK
+
+#endif // __FFLASFFPACK_ffpack_bitsliced_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -54,6 +54,16 @@ namespace FFPACK {
               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
               typename PolRing::Domain_t::RandIter& G,const FFPACK_CHARPOLY_TAG CharpTag,
               const size_t degree)
+    {
+        return CharPoly (R, charp, N, A, lda, G, FFLAS::ParSeqHelper::Sequential(), CharpTag, degree);
+    }
+
+    template <class PolRing, class PSHelper>
+    std::list<typename PolRing::Element>&
+    CharPoly (const PolRing& R, std::list<typename PolRing::Element>& charp, const size_t N,
+              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+              typename PolRing::Domain_t::RandIter& G, const PSHelper& psH,
+              const FFPACK_CHARPOLY_TAG CharpTag, const size_t degree)
     {
         // if (Protected::AreEqual<PolRing::Domain_t, Givaro::Modular<double> >::value ||
         //     Protected::AreEqual<PolRing::Domain_t, Givaro::ModularBalanced<double> >::value){
@@ -77,7 +87,7 @@ namespace FFPACK {
             case FfpackLUK:
             {
                 typename Field::Element_ptr X = FFLAS::fflas_new (F, N, N+1);
-                Protected::LUKrylov (F, charp, N, A, lda, X, N, G);
+                Protected::LUKrylov (F, charp, N, A, lda, X, N, G, psH);
                 FFLAS::fflas_delete (X);
                 return charp;
             }
@@ -88,7 +98,7 @@ namespace FFPACK {
                 
                 Givaro::Integer p = F.characteristic();
                 if (p < (uint64_t)N)	// Heuristic condition (the pessimistic theoretical one being p<2n^2).
-                    return CharPoly(R, charp, N, A, lda, G, FfpackLUK);
+                    return CharPoly(R, charp, N, A, lda, G, psH, FfpackLUK);
                 do{
                     typename Field::Element_ptr B = nullptr;
                     cont=false;
@@ -96,9 +106,9 @@ namespace FFPACK {
                             // Preconditionning by a random block Krylov matrix.
                             // Some invariant factors may be discovered in the process and are stored in charp.
                         size_t ldb, Nb;
-                        Protected::RandomKrylovPrecond (R, charp, N, A, lda, Nb, B, ldb, G, degree);
+                        Protected::RandomKrylovPrecond (R, charp, N, A, lda, Nb, B, ldb, G, degree, psH);
                             // Calling the main algorithm on the preconditionned part
-                        Protected::ArithProg (R, charp, Nb, B, ldb, degree);
+                        Protected::ArithProg (R, charp, Nb, B, ldb, degree, psH);
                         FFLAS::fflas_delete(B);
                     }
                     catch (CharpolyFailed){
@@ -108,14 +118,14 @@ namespace FFPACK {
                         if (++attempts < 2)
                             cont = true;
                         else
-                            return CharPoly (R, charp, N, A, lda, G, FfpackLUK);
+                            return CharPoly (R, charp, N, A, lda, G, psH, FfpackLUK);
                     }
                                    } while (cont);
                 return charp;
             }
             case FfpackArithProg:
             {
-                return Protected::ArithProg (R, charp, N, A, lda, 1);
+                return Protected::ArithProg (R, charp, N, A, lda, 1, psH);
             }
 
         case FfpackKG: return Protected::KellerGehrig (F, charp, N, A, lda);
@@ -138,7 +148,7 @@ namespace FFPACK {
         default:
                             {
                                 typename Field::Element_ptr X = FFLAS::fflas_new (F, N, N+1);
-                                Protected::LUKrylov (F, charp, N, A, lda, X, N, G);
+                                Protected::LUKrylov (F, charp, N, A, lda, X, N, G, psH);
                                 FFLAS::fflas_delete (X);
                                 return charp;
                             }
@@ -152,6 +162,29 @@ namespace FFPACK {
               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
               typename PolRing::Domain_t::RandIter& G, const FFPACK_CHARPOLY_TAG CharpTag,
               const size_t degree){
+        return CharPoly (R, charp, N, A, lda, G, FFLAS::ParSeqHelper::Sequential(), CharpTag, degree);
+    }
+
+    template <class PolRing>
+    typename PolRing::Element&
+    pCharPoly (const PolRing& R, typename PolRing::Element& charp, const size_t N,
+               typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+               typename PolRing::Domain_t::RandIter& G, size_t numthreads,
+               const FFPACK_CHARPOLY_TAG CharpTag, const size_t degree){
+        PAR_BLOCK{
+            size_t nt = numthreads ? numthreads : NUM_THREADS;
+            FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::Threads> parH(nt);
+            CharPoly (R, charp, N, A, lda, G, parH, CharpTag, degree);
+        }
+        return charp;
+    }
+
+    template <class PolRing, class PSHelper>
+    typename PolRing::Element&
+    CharPoly (const PolRing& R, typename PolRing::Element& charp, const size_t N,
+              typename PolRing::Domain_t::Element_ptr A, const size_t lda,
+              typename PolRing::Domain_t::RandIter& G, const PSHelper& psH,
+              const FFPACK_CHARPOLY_TAG CharpTag, const size_t degree){
 
         typedef typename PolRing::Domain_t Field;
         typedef typename PolRing::Element Polynomial;
@@ -162,7 +195,7 @@ namespace FFPACK {
         Checker_charpoly<Field,Polynomial> checker(R.getdomain(),N,A,lda);
 
         std::list<Polynomial> factor_list;
-        CharPoly (R, factor_list, N, A, lda, G, CharpTag, degree);
+        CharPoly (R, factor_list, N, A, lda, G, psH, CharpTag, degree);
         typename std::list<Polynomial>::const_iterator it;
         it = factor_list.begin();
 
@@ -180,11 +213,12 @@ namespace FFPACK {
 
 
     namespace Protected {
-        template <class Field, class Polynomial, class RandIter>
+        template <class Field, class Polynomial, class RandIter, class PSHelper>
         std::list<Polynomial>&
         LUKrylov (const Field& F, std::list<Polynomial>& charp, const size_t N,
                   typename Field::Element_ptr A, const size_t lda,
-                  typename Field::Element_ptr X, const size_t ldx, RandIter& G)
+                  typename Field::Element_ptr X, const size_t ldx, RandIter& G,
+                  const PSHelper& psH)
         {
             typedef typename Field::Element elt;
             elt* Ai, *Xi, *X2=X;
@@ -201,7 +235,7 @@ namespace FFPACK {
 
                 FFPACK::NonZeroRandomMatrix (F, 1, Ncurr, v, Ncurr, G);
 
-                MatVecMinPoly (F, minP, Ncurr, A, lda, v, 1, X2, ldx, P);
+                MatVecMinPoly (F, minP, Ncurr, A, lda, v, 1, X2, ldx, P, psH);
 
                 FFLAS::fflas_delete (v);
 
@@ -241,7 +275,7 @@ namespace FFPACK {
                 // X21 = X21 . S1^-1
                 ftrsm(F, FFLAS::FflasRight, FFLAS::FflasUpper,
                       FFLAS::FflasNoTrans, FFLAS::FflasUnit, Nrest, k,
-                      F.one, X2, ldx, X21, ldx);
+                      F.one, X2, ldx, X21, ldx, psH);
                 // Creation of the matrix A2 for recurise call
                 for (Xi = X22, Ai = A;
                      Xi != X22 + Nrest*ldx;
@@ -249,7 +283,7 @@ namespace FFPACK {
                     for (size_t jj=0; jj<Nrest; ++jj)
                         *(Ai++) = *(Xi++);
                 fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Nrest, Nrest, k, F.mOne,
-                       X21, ldx, X2+k, ldx, F.one, A, lda);
+                       X21, ldx, X2+k, ldx, F.one, A, lda, psH);
                 X2 = X22;
                 Ncurr = Nrest;
             }
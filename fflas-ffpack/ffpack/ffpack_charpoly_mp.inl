@@ -32,6 +32,7 @@
 
 #include "fflas-ffpack/field/rns-integer.h"
 #include "fflas-ffpack/fflas-ffpack.h"
+#include "fflas-ffpack/ffpack/ffpack_multimod_mp.inl"
 
 namespace FFPACK {
 
@@ -58,12 +59,17 @@ namespace FFPACK {
 
         return charp;
     }
-    template <>
+    /** Characteristic polynomial over Z by multimodular reduction, see
+     * Protected::MultimodReconstruct: certif > 0 stops as soon as certif more primes
+     * leave it unchanged, certif = 0 runs all the primes of the coefficient bound.
+     * The overload without certif uses FFLAS::tuning().EarlyTermination.
+     */
     inline Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >::Element&
     CharPoly(const Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >& R,
              Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >::Element& charp,
              const size_t N,  Givaro::Integer * A, const size_t lda,
-             Givaro::ZRing<Givaro::Integer>::RandIter& G, const FFPACK_CHARPOLY_TAG CharpTag, size_t degree){
+             Givaro::ZRing<Givaro::Integer>::RandIter& G, const FFPACK_CHARPOLY_TAG CharpTag, size_t degree,
+             const size_t certif){
 
         const Givaro::ZRing<Givaro::Integer>& F = R.getdomain();
         size_t Abs = FFLAS::bitsize(F,N,N,A,lda);
@@ -71,31 +77,28 @@ namespace FFPACK {
         // of the coefficients of the characteristic polynomial
         int64_t CPbs = (int64_t) ceil(N/2.0*(log(double(N))/log(2.0)+2*Abs+0.21163275));
         Givaro::Integer CPbound = Givaro::Integer(1) << CPbs;
-
-        FFPACK::rns_double RNS(CPbound, 23);
+        const size_t k = (Abs/16)+((Abs%16)?1:0);
         typedef FFPACK::RNSInteger<FFPACK::rns_double> RnsDomain;
-        RnsDomain Zrns(RNS);
-        typename RnsDomain::Element_ptr Arns, CPrns;
-        Arns = FFLAS::fflas_new(Zrns,N,N);
-        CPrns = FFLAS::fflas_new(Zrns,1,N+1);
-        //std::cerr<<"finit...";
-        FFLAS::finit_rns(Zrns,N,N,(Abs/16)+((Abs%16)?1:0),A,lda,Arns);
-        //std::cerr<<"...done"<<std::endl;
 
-        //std::cerr<<"charpoly...";
-        CharPoly(Zrns, CPrns, N, Arns, N, G, CharpTag, degree);
-        //std::cerr<<"...done"<<std::endl;
-
-        //std::cerr<<"fconvert...";
         charp.resize(N+1);
-        FFLAS::fconvert_rns (Zrns,1,N+1, Givaro::Integer(1),&(charp[0]), N+1, CPrns);
-        //std::cerr<<"...done"<<std::endl;
-
-        FFLAS::fflas_delete(Arns);
-        FFLAS::fflas_delete(CPrns);
+        Protected::MultimodReconstruct (&(charp[0]), N+1, CPbound, k, certif,
+                                        [&](const RnsDomain& Zrns, typename RnsDomain::Element_ptr CPrns){
+                                            typename RnsDomain::Element_ptr Arns = FFLAS::fflas_new(Zrns,N,N);
+                                            FFLAS::finit_rns(Zrns,N,N,k,A,lda,Arns);
+                                            CharPoly(Zrns, CPrns, N, Arns, N, G, CharpTag, degree);
+                                            FFLAS::fflas_delete(Arns);
+                                        });
         return charp;
     }
 
+    template <>
+    inline Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >::Element&
+    CharPoly(const Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >& R,
+             Givaro::Poly1Dom<Givaro::ZRing<Givaro::Integer> >::Element& charp,
+             const size_t N,  Givaro::Integer * A, const size_t lda,
+             Givaro::ZRing<Givaro::Integer>::RandIter& G, const FFPACK_CHARPOLY_TAG CharpTag, size_t degree){
+        return CharPoly (R, charp, N, A, lda, G, CharpTag, degree, FFLAS::tuning().EarlyTermination);
+    }
 
 }
 
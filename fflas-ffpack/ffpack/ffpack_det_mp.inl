@@ -31,6 +31,7 @@
 
 #include "fflas-ffpack/field/rns-integer.h"
 #include "fflas-ffpack/fflas-ffpack.h"
+#include "fflas-ffpack/ffpack/ffpack_multimod_mp.inl"
 
 namespace FFPACK {
 
@@ -51,11 +52,16 @@ namespace FFPACK {
     }
 
 
+    /** Determinant over Z by multimodular reduction, see Protected::MultimodReconstruct.
+     * certif > 0 stops as soon as certif more primes leave the determinant unchanged,
+     * instead of running all the primes of Hadamard's bound (certif = 0).
+     * The overload without certif uses FFLAS::tuning().EarlyTermination.
+     */
     template <class PSHelper>
     inline Givaro::Integer&
     Det (const Givaro::ZRing<Givaro::Integer>& F, Givaro::Integer& det,
          const size_t N,  Givaro::Integer * A, const size_t lda,
-         const PSHelper& psH, size_t*P,size_t*Q){
+         const PSHelper& psH, size_t*P, size_t*Q, const size_t certif){
 
         if (N==0)
             return  F.assign(det,F.one);
@@ -64,22 +70,27 @@ namespace FFPACK {
         // Hadamard's bound on the bitsize of the determinant over Z
         int64_t Detbs = (int64_t) ceil (N * (log(double(N))/(log(2.0)*2.0) + Abs));
         Givaro::Integer Detbound = Givaro::Integer(1) << Detbs;
-        FFPACK::rns_double RNS(Detbound, 23);
+        const size_t k = (Abs/16)+((Abs%16)?1:0);
         typedef FFPACK::RNSInteger<FFPACK::rns_double> RnsDomain;
-        RnsDomain Zrns(RNS);
-        typename RnsDomain::Element_ptr Arns, Detrns;
-        Arns = FFLAS::fflas_new(Zrns,N,N);
-        Detrns = FFLAS::fflas_new(Zrns,1,1);
-
-        FFLAS::finit_rns(Zrns,N,N,(Abs/16)+((Abs%16)?1:0),A,lda,Arns);
-        Det(Zrns, Detrns, N, Arns, N, psH);
-        FFLAS::fconvert_rns (Zrns,1,1, Givaro::Integer(1),&det, 1, Detrns);
 
-        FFLAS::fflas_delete(Arns);
-        FFLAS::fflas_delete(Detrns);
+        Protected::MultimodReconstruct (&det, 1, Detbound, k, certif,
+                                        [&](const RnsDomain& Zrns, typename RnsDomain::Element_ptr Detrns){
+                                            typename RnsDomain::Element_ptr Arns = FFLAS::fflas_new(Zrns,N,N);
+                                            FFLAS::finit_rns(Zrns,N,N,k,A,lda,Arns);
+                                            Det(Zrns, Detrns, N, Arns, N, psH);
+                                            FFLAS::fflas_delete(Arns);
+                                        });
         return det;
     }
 
+    template <class PSHelper>
+    inline Givaro::Integer&
+    Det (const Givaro::ZRing<Givaro::Integer>& F, Givaro::Integer& det,
+         const size_t N,  Givaro::Integer * A, const size_t lda,
+         const PSHelper& psH, size_t*P,size_t*Q){
+        return Det (F, det, N, A, lda, psH, P, Q, FFLAS::tuning().EarlyTermination);
+    }
+
 }
 
 #endif
@@ -70,12 +70,13 @@ namespace FFPACK { namespace Protected {
                            const size_t * d, const size_t nb_blocs);
 
 
-    template <class PolRing>
+    template <class PolRing, class PSHelper>
     inline void
     RandomKrylovPrecond (const PolRing& PR, std::list<typename PolRing::Element>& completedFactors, const size_t N,
                          typename PolRing::Domain_t::Element_ptr A, const size_t lda,
                          size_t & Nb, typename PolRing::Domain_t::Element_ptr& B, size_t& ldb,
-                         typename PolRing::Domain_t::RandIter& g, const size_t degree)
+                         typename PolRing::Domain_t::RandIter& g, const size_t degree,
+                         const PSHelper& psH)
     {
         typedef typename PolRing::Domain_t Field;
         typedef typename PolRing::Element Polynomial;
@@ -107,7 +108,7 @@ namespace FFPACK { namespace Protected {
         // Computing the bloc Krylov matrix [u1 Au1 .. A^(c-1) u1 u2 Au2 ...]^T
         for (size_t i = 1; i<degree; ++i){
             fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasTrans,  noc, N, N,F.one,
-                   K+(i-1)*ldk, degree*ldk, A, lda, F.zero, K+i*ldk, degree*ldk);
+                   K+(i-1)*ldk, degree*ldk, A, lda, F.zero, K+i*ldk, degree*ldk, psH);
         }
         // K2 <- K (re-ordering)
         //! @todo swap to save space ??
@@ -135,7 +136,9 @@ namespace FFPACK { namespace Protected {
             Pk[i] = 0;
 
             // @todo: replace by PLUQ
-        size_t R = LUdivine(F, FFLAS::FflasNonUnit, FFLAS::FflasNoTrans, N, N, K, ldk, Pk, Qk);
+            // the degree sequence below is read on the row rank profile Qk of the CUP decomposition
+        size_t R = LUdivine(F, FFLAS::FflasNonUnit, FFLAS::FflasNoTrans, N, N, K, ldk, Pk, Qk,
+                            FfpackSlabRecursive, __FFLASFFPACK_LUDIVINE_THRESHOLD, psH);
         size_t row_idx = 0;
         size_t ii=0;
         size_t dold = degree;
@@ -177,19 +180,19 @@ namespace FFPACK { namespace Protected {
         FFLAS::fflas_delete (K2);
 
         // K <- K A^T
-        fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasTrans, Mk, N, N,F.one,  K3, ldk, A, lda, F.zero, K4, ldk);
+        fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasTrans, Mk, N, N,F.one,  K3, ldk, A, lda, F.zero, K4, ldk, psH);
 
         // K <- K P^T
         applyP (F, FFLAS::FflasRight, FFLAS::FflasTrans, Mk, 0,(int) R, K4, ldk, Pk);
 
         // K <- K U^-1
-        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, Mk, R,F.one, K, ldk, K4, ldk);
+        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit, Mk, R,F.one, K, ldk, K4, ldk, psH);
 
         // L <-  Q^T L
         applyP(F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N, 0,(int) R, K, ldk, Qk);
 
         // K <- K L^-1
-        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, Mk, R,F.one, K, ldk, K4, ldk);
+        ftrsm (F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit, Mk, R,F.one, K, ldk, K4, ldk, psH);
 
         //undoing permutation on L
         applyP(F, FFLAS::FflasLeft, FFLAS::FflasTrans, N, 0,(int) R, K, ldk, Qk);
@@ -255,7 +258,7 @@ namespace FFPACK { namespace Protected {
             applyP( F, FFLAS::FflasRight, FFLAS::FflasTrans, Nrest, 0,(int) R, K21, ldk, Pk);
 
             // K21 = K21 . S1^-1
-            ftrsm (F, FFLAS::FflasRight,FFLAS::FflasUpper,FFLAS::FflasNoTrans,FFLAS::FflasNonUnit, Nrest, R, F.one, K, ldk, K21, ldk);
+            ftrsm (F, FFLAS::FflasRight,FFLAS::FflasUpper,FFLAS::FflasNoTrans,FFLAS::FflasNonUnit, Nrest, R, F.one, K, ldk, K21, ldk, psH);
 
             typename Field::Element_ptr Arec = FFLAS::fflas_new (F, Nrest, Nrest);
             size_t ldarec = Nrest;
@@ -263,13 +266,13 @@ namespace FFPACK { namespace Protected {
             // Creation of the matrix A2 for recursive call
             FFLAS::fassign (F, Nrest, Nrest, K22, ldk, Arec, ldarec);
 
-            fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Nrest, Nrest, R,F.mOne, K21, ldk, K+R, ldk,F.one, Arec, ldarec);
+            fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Nrest, Nrest, R,F.mOne, K21, ldk, K+R, ldk,F.one, Arec, ldarec, psH);
 
             std::list<Polynomial> polyList;
             polyList.clear();
 
             // Recursive call on the complementary subspace
-            CharPoly (PR, polyList, Nrest, Arec, ldarec, g, FfpackArithProgKrylovPrecond);
+            CharPoly (PR, polyList, Nrest, Arec, ldarec, g, psH, FfpackArithProgKrylovPrecond);
             FFLAS::fflas_delete (Arec);
             completedFactors.merge(polyList);
         }
@@ -293,11 +296,11 @@ namespace FFPACK { namespace Protected {
 
     }
 
-    template <class PolRing>
+    template <class PolRing, class PSHelper>
     inline std::list<typename PolRing::Element>&
     ArithProg (const PolRing& PR, std::list<typename PolRing::Element>& frobeniusForm,
                const size_t N, typename PolRing::Domain_t::Element_ptr A, const size_t lda,
-               const size_t degree)
+               const size_t degree, const PSHelper& psH)
     {
 
         typedef typename PolRing::Domain_t Field;
@@ -416,9 +419,9 @@ namespace FFPACK { namespace Protected {
 
             // K <- A K
             fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Ncurr-Ma, nb_full_blocks, Ma,F.one,
-                   Ac, ldac, K+(Ncurr-Ma)*ldk, ldk,F.one, K, ldk);
+                   Ac, ldac, K+(Ncurr-Ma)*ldk, ldk,F.one, K, ldk, psH);
             fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Ma, nb_full_blocks, Ma,F.one,
-                   Ac+(Ncurr-Ma)*ldac, ldac, K+(Ncurr-Ma)*ldk, ldk, F.zero, Arp, ldarp);
+                   Ac+(Ncurr-Ma)*ldac, ldac, K+(Ncurr-Ma)*ldk, ldk, F.zero, Arp, ldarp, psH);
             for (size_t i=0; i< Ma; ++i)
                 FFLAS::fassign(F, nb_full_blocks, Arp+i*ldarp, 1, K+(Ncurr-Ma+i)*ldk, 1);
 
@@ -457,7 +460,7 @@ namespace FFPACK { namespace Protected {
             applyP (F, FFLAS::FflasLeft, FFLAS::FflasTrans,
                     Mk, 0,(int) Mk, K+(Ncurr-Mk)*ldk,ldk, P);
             fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Ncurr-Mk, Mk, Mk,F.mOne,
-                   K3, ldk, K+(Ncurr-Mk)*ldk,ldk,F.one, K, ldk);
+                   K3, ldk, K+(Ncurr-Mk)*ldk,ldk,F.one, K, ldk, psH);
             FFLAS::fflas_delete( P);
             FFLAS::fflas_delete( Q);
 
@@ -413,6 +413,21 @@ namespace FFPACK {
               , const FFPACK::FFPACK_LU_TAG LuTag // =FFPACK::FfpackSlabRecursive
               , const size_t cutoff // =__FFPACK_LUDIVINE_CUTOFF
              )
+    {
+        return LUdivine (F, Diag, trans, M, N, A, lda, P, Q, LuTag, cutoff, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class PSHelper>
+    inline size_t
+    LUdivine (const Field& F,
+              const FFLAS::FFLAS_DIAG Diag, const FFLAS::FFLAS_TRANSPOSE trans,
+              const size_t M, const size_t N,
+              typename Field::Element_ptr A, const size_t lda,
+              size_t*P, size_t *Q
+              , const FFPACK::FFPACK_LU_TAG LuTag
+              , const size_t cutoff
+              , const PSHelper& psH
+             )
     {
         if ( !(M && N) ) return 0;
         typedef typename Field::Element elt;
@@ -508,7 +523,7 @@ namespace FFPACK {
                 size_t R, R2;
                 if (trans == FFLAS::FflasTrans){
                     R = LUdivine (F, Diag, trans, colDim, Nup, A, lda, P, Q,
-                                  LuTag, cutoff);
+                                  LuTag, cutoff, psH);
 
                     typename Field::Element_ptr Ar = A + Nup*incRow;   // SW
                     typename Field::Element_ptr Ac = A + R*incCol;     // NE
@@ -524,14 +539,14 @@ namespace FFPACK {
                         // Ar <- L1^-1 Ar
                         FFLAS::ftrsm( F, FFLAS::FflasLeft, FFLAS::FflasLower,
                                       FFLAS::FflasNoTrans, Diag, R, Ndown,
-                                      F.one, A, lda, Ar, lda);
+                                      F.one, A, lda, Ar, lda, psH);
                         // An <- An - Ac*Ar
                         if (colDim>R)
                             fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, colDim-R, Ndown, R,
-                                   F.mOne, Ac, lda, Ar, lda, F.one, An, lda);
+                                   F.mOne, Ac, lda, Ar, lda, F.one, An, lda, psH);
                     }
                     // Recursive call on SE
-                    R2 = LUdivine (F, Diag, trans, colDim-R, Ndown, An, lda, P + R, Q + Nup, LuTag, cutoff);
+                    R2 = LUdivine (F, Diag, trans, colDim-R, Ndown, An, lda, P + R, Q + Nup, LuTag, cutoff, psH);
                     for (size_t i = R; i < R + R2; ++i)
                         P[i] += R;
                     if (R2) {
@@ -546,7 +561,7 @@ namespace FFPACK {
 
                 }
                 else { // trans == FFLAS::FflasNoTrans
-                    R = LUdivine (F, Diag, trans, Nup, colDim, A, lda, P, Q, LuTag, cutoff);
+                    R = LUdivine (F, Diag, trans, Nup, colDim, A, lda, P, Q, LuTag, cutoff, psH);
                     typename Field::Element_ptr Ar = A + Nup*incRow;   // SW
                     typename Field::Element_ptr Ac = A + R*incCol;     // NE
                     typename Field::Element_ptr An = Ar+ R*incCol;     // SE
@@ -562,15 +577,15 @@ namespace FFPACK {
                         // Ar <- Ar.U1^-1
                         ftrsm( F, FFLAS::FflasRight, FFLAS::FflasUpper,
                                FFLAS::FflasNoTrans, Diag, Ndown, R,
-                               F.one, A, lda, Ar, lda);
+                               F.one, A, lda, Ar, lda, psH);
                         // An <- An - Ar*Ac
                         if (colDim>R)
                             fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Ndown, colDim-R, R,
-                                   F.mOne, Ar, lda, Ac, lda, F.one, An, lda );
+                                   F.mOne, Ar, lda, Ac, lda, F.one, An, lda, psH);
 
                     }
                     // Recursive call on SE
-                    R2=LUdivine (F, Diag, trans, Ndown, N-R, An, lda,P+R, Q+Nup, LuTag, cutoff);
+                    R2=LUdivine (F, Diag, trans, Ndown, N-R, An, lda,P+R, Q+Nup, LuTag, cutoff, psH);
                     for (size_t i = R; i < R + R2; ++i)
                         P[i] += R;
                     if (R2)
@@ -643,6 +658,50 @@ namespace FFPACK {
                             , const size_t kg_j // =0
                           )
         {
+            return LUdivine_construct (F, Diag, M, N, A, lda, X, ldx, u, incu, P, computeX,
+                                       MinTag, kg_mc, kg_mb, kg_j, FFLAS::ParSeqHelper::Sequential());
+        }
+
+        // Krylov iterate y <- A.u of LUdivine_construct
+        template <class Field>
+        inline void
+        fgemv_krylov (const Field& F, const size_t N,
+                      typename Field::ConstElement_ptr A, const size_t lda,
+                      typename Field::ConstElement_ptr u, const size_t incu,
+                      typename Field::Element_ptr y, const FFLAS::ParSeqHelper::Sequential)
+        {
+            fgemv (F, FFLAS::FflasNoTrans, N, N, F.one, A, lda, u, incu, F.zero, y, 1);
+        }
+
+        // the rows of A are cut in as many blocks as threads
+        template <class Field, class Cut, class Param>
+        inline void
+        fgemv_krylov (const Field& F, const size_t N,
+                      typename Field::ConstElement_ptr A, const size_t lda,
+                      typename Field::ConstElement_ptr u, const size_t incu,
+                      typename Field::Element_ptr y, const FFLAS::ParSeqHelper::Parallel<Cut,Param> par)
+        {
+            typedef FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Row,FFLAS::StrategyParameter::Threads> RowPar_t;
+            FFLAS::MMHelper<Field, FFLAS::MMHelperAlgo::Classic, typename FFLAS::ModeTraits<Field>::value, RowPar_t>
+            H (F, -1, RowPar_t (par.numthreads()));
+            fgemv (F, FFLAS::FflasNoTrans, N, N, F.one, A, lda, u, incu, F.zero, y, 1, H);
+        }
+
+        template <class Field, class PSHelper>
+        size_t
+        LUdivine_construct( const Field& F, const FFLAS::FFLAS_DIAG Diag,
+                            const size_t M, const size_t N,
+                            typename Field::ConstElement_ptr A, const size_t lda,
+                            typename Field::Element_ptr X, const size_t ldx,
+                            typename Field::Element_ptr u, const size_t incu, size_t* P,
+                            bool computeX
+                            , const FFPACK::FFPACK_MINPOLY_TAG MinTag
+                            , const size_t kg_mc
+                            , const size_t kg_mb
+                            , const size_t kg_j
+                            , const PSHelper& psH
+                          )
+        {
 
             size_t MN = std::min(M,N);
 
@@ -679,7 +738,7 @@ namespace FFPACK {
 
                 // Recursive call on NW
                 size_t R = LUdivine_construct(F, Diag, Nup, N, A, lda, X, ldx, u, incu,
-                                              P, computeX, MinTag, kg_mc, kg_mb, kg_j );
+                                              P, computeX, MinTag, kg_mc, kg_mb, kg_j, psH);
                 if (R==Nup){
                     typename Field::Element_ptr Xr = X + Nup*ldx; //  SW
                     typename Field::Element_ptr Xc = X + Nup;     //  NE
@@ -688,8 +747,7 @@ namespace FFPACK {
                     if ( computeX ){
                         if (MinTag == FFPACK::FfpackDense)
                             for (size_t i=0; i< Ndown; ++i, Xi+=ldx){
-                                fgemv(F, FFLAS::FflasNoTrans, N, N, F.one,
-                                      A, lda, u, incu, F.zero, Xi,1);
+                                fgemv_krylov (F, N, A, lda, u, incu, Xi, psH);
                                 FFLAS::fassign(F, N,Xi, 1, u,incu);
                             }
                         else // Keller-Gehrig Fast algorithm's matrix
@@ -705,18 +763,18 @@ namespace FFPACK {
                     // Triangular block inversion of NW and apply to SW
                     // Xr <- Xr.U1^-1
                     ftrsm( F, FFLAS::FflasRight, FFLAS::FflasUpper, FFLAS::FflasNoTrans, Diag,
-                           Ndown, R, F.one, X, ldx, Xr, ldx);
+                           Ndown, R, F.one, X, ldx, Xr, ldx, psH);
 
                     // Update of SE
                     // Xn <- Xn - Xr*Xc
                     fgemm( F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, Ndown, N-Nup, Nup,
-                           F.mOne, Xr, ldx, Xc, ldx, F.one, Xn, ldx);
+                           F.mOne, Xr, ldx, Xc, ldx, F.one, Xn, ldx, psH);
 
                     // Recursive call on SE
 
                     size_t R2 = LUdivine_construct(F, Diag, Ndown, N-Nup, A, lda,
                                                    Xn, ldx, u, incu, P + Nup,
-                                                   false, MinTag, kg_mc, kg_mb, kg_j);
+                                                   false, MinTag, kg_mc, kg_mb, kg_j, psH);
                     for ( size_t i=R;i<R+R2;++i) P[i] += R;
 
                     FFPACK::applyP( F, FFLAS::FflasRight, FFLAS::FflasTrans,
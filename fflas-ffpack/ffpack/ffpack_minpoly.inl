@@ -41,6 +41,27 @@ namespace FFPACK {
     MinPoly (const Field& F, Polynomial& minP, const size_t N,
              typename Field::ConstElement_ptr A, const size_t lda,
              RandIter& G){
+        return MinPoly (F, minP, N, A, lda, G, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class Polynomial, class RandIter>
+    inline Polynomial&
+    pMinPoly (const Field& F, Polynomial& minP, const size_t N,
+              typename Field::ConstElement_ptr A, const size_t lda,
+              RandIter& G, size_t numthreads){
+        PAR_BLOCK{
+            size_t nt = numthreads ? numthreads : NUM_THREADS;
+            FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::Threads> parH(nt);
+            MinPoly (F, minP, N, A, lda, G, parH);
+        }
+        return minP;
+    }
+
+    template <class Field, class Polynomial, class RandIter, class PSHelper>
+    inline Polynomial&
+    MinPoly (const Field& F, Polynomial& minP, const size_t N,
+             typename Field::ConstElement_ptr A, const size_t lda,
+             RandIter& G, const PSHelper& psH){
 
         if (N==0){
             minP.resize(1);
@@ -52,7 +73,7 @@ namespace FFPACK {
         // Picking a non-zero random vector
         NonZeroRandomMatrix (F, 1, N, v, N, G);
 
-        MatVecMinPoly (F, minP, N, A, lda, v, 1);
+        MatVecMinPoly (F, minP, N, A, lda, v, 1, psH);
 
         FFLAS::fflas_delete(v);
         return minP;
@@ -63,6 +84,15 @@ namespace FFPACK {
     MatVecMinPoly (const Field& F, Polynomial& minP, const size_t N,
                    typename Field::ConstElement_ptr A, const size_t lda,
                    typename Field::ConstElement_ptr v, const size_t incv){
+        return MatVecMinPoly (F, minP, N, A, lda, v, incv, FFLAS::ParSeqHelper::Sequential());
+    }
+
+    template <class Field, class Polynomial, class PSHelper>
+    inline Polynomial&
+    MatVecMinPoly (const Field& F, Polynomial& minP, const size_t N,
+                   typename Field::ConstElement_ptr A, const size_t lda,
+                   typename Field::ConstElement_ptr v, const size_t incv,
+                   const PSHelper& psH){
 
         // Construct the Krylov matrix K and eliminate it online
         typename Field::Element_ptr K = FFLAS::fflas_new(F, N+1, N);
@@ -72,7 +102,7 @@ namespace FFPACK {
         typename Field::Element_ptr u = FFLAS::fflas_new(F, 1, N);
         FFLAS::fassign (F, N, v, incv, u, 1);
 
-        Protected::MatVecMinPoly(F, minP, N, A, lda, u, 1, K, ldk, P);
+        Protected::MatVecMinPoly(F, minP, N, A, lda, u, 1, K, ldk, P, psH);
 
         FFLAS::fflas_delete (u);
         FFLAS::fflas_delete (P);
@@ -84,20 +114,21 @@ namespace FFPACK {
 
     namespace Protected {
 
-        template <class Field, class Polynomial>
+        template <class Field, class Polynomial, class PSHelper>
         inline Polynomial&
         MatVecMinPoly (const Field& F, Polynomial& minP, const size_t N,
                        typename Field::ConstElement_ptr A, const size_t lda,
                        typename Field::Element_ptr v, const size_t incv,
                        typename Field::Element_ptr K, const size_t ldk,
-                       size_t * P){
+                       size_t * P, const PSHelper& psH){
 
             FFLAS::fassign (F, N, v, incv, K, 1);
 
             // Construct the Krylov matrix K and eliminate it online
             // LUP factorization on K, construct K on the fly
 
-            size_t k = Protected::LUdivine_construct (F, FFLAS::FflasUnit, N+1, N, A, lda, K, ldk, v, incv, P, true, FfpackDense);
+            size_t k = Protected::LUdivine_construct (F, FFLAS::FflasUnit, N+1, N, A, lda, K, ldk, v, incv, P, true,
+                                                      FfpackDense, 0, 0, 0, psH);
 
 
             minP.resize(k+1);
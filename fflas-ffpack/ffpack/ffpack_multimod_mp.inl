@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+#ifndef __FFPACK_multimod_mp_INL
+#define __FFPACK_multimod_mp_INL
+
+#include <algorithm>
+#include <vector>
+#include <gmp.h>
+#include <givaro/givinteger.h>
+#include <givaro/givintprime.h>
+
+#include "fflas-ffpack/field/rns-integer.h"
+
+namespace FFPACK {
+
+    namespace Protected {
+
+        /** @brief Multimodular reconstruction of len integers, of absolute value below bound/2.
+         *
+         * image(Zrns, R) sets the 1 x len RNS vector R to the images of the result
+         * modulo the primes of Zrns; k is the size, in 16-bit chunks, of the integers
+         * it converts to Zrns.
+         *
+         * With certif = 0, the primes of the bound are all used in a single batch.
+         * Otherwise the primes come by batches of at least certif primes, doubling
+         * the number of primes used so far, and the centered CRT reconstruction is
+         * updated after each batch: it is returned as soon as a whole batch leaves
+         * it unchanged, or once the product of the primes reaches the bound.
+         * The early result is wrong only if each of the certif (random) primes of
+         * the last batch divides the difference with the actual result.
+         */
+        template <class ImageFunc>
+        inline void
+        MultimodReconstruct (Givaro::Integer* res, const size_t len, const Givaro::Integer& bound,
+                             const size_t k, const size_t certif, ImageFunc image)
+        {
+            typedef FFPACK::RNSInteger<FFPACK::rns_double> RnsDomain;
+            if (!certif){
+                FFPACK::rns_double RNS(bound, 23);
+                if (RNS._ldm < k) RNS.precompute_cst(k);
+                RnsDomain Zrns(RNS);
+                typename RnsDomain::Element_ptr R = FFLAS::fflas_new(Zrns,1,len);
+                image(Zrns, R);
+                FFLAS::fconvert_rns(Zrns, 1, len, Givaro::Integer(0), res, len, R);
+                FFLAS::fflas_delete(R);
+                return;
+            }
+
+            Givaro::IntPrimeDom IPD;
+            Givaro::Integer M(1), Mb, Minv, p, d;
+            std::vector<Givaro::Integer> rb(len);
+            size_t nprimes = 0;
+            while (M < bound){
+                // a batch of new primes, distinct from the previous ones
+                const size_t batch = std::max(certif, nprimes);
+                std::vector<double> basis;
+                Mb = 1;
+                while (basis.size() < batch && M*Mb < bound){
+                    do {
+                        Givaro::Integer::random_exact_2exp(p, 22);
+                        IPD.nextprimein(p);
+                    } while ((M*Mb) % p == 0);
+                    basis.push_back((double)p);
+                    Mb *= p;
+                }
+                FFPACK::rns_double RNS(basis);
+                if (RNS._ldm < k) RNS.precompute_cst(k);
+                RnsDomain Zrns(RNS);
+                typename RnsDomain::Element_ptr R = FFLAS::fflas_new(Zrns,1,len);
+                image(Zrns, R);
+                FFLAS::fconvert_rns(Zrns, 1, len, Givaro::Integer(0), rb.data(), len, R);
+                FFLAS::fflas_delete(R);
+
+                if (!nprimes)
+                    std::copy(rb.begin(), rb.end(), res);
+                else {
+                    // res + M.((rb-res)/M mod Mb), centered modulo M.Mb
+                    bool unchanged = true;
+                    mpz_invert(reinterpret_cast<mpz_ptr>(&Minv), reinterpret_cast<mpz_srcptr>(&M),
+                               reinterpret_cast<mpz_srcptr>(&Mb));
+                    const Givaro::Integer MMb = M*Mb;
+                    for (size_t i=0; i<len; i++){
+                        d = (rb[i]-res[i]) % Mb;
+                        if (d == 0) continue;
+                        unchanged = false;
+                        d = (d*Minv) % Mb;
+                        if (d < 0) d += Mb;
+                        res[i] += M*d;
+                        if (2*res[i] > MMb) res[i] -= MMb;
+                    }
+                    if (unchanged && basis.size() >= certif)
+                        return;
+                }
+                nprimes += basis.size();
+                M *= Mb;
+            }
+        }
+
+    } // Protected
+
+} // FFPACK
+
+#endif // __FFPACK_multimod_mp_INL
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
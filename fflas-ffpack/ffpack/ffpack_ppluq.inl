@@ -76,7 +76,7 @@ namespace FFPACK {
     }
 
 
-    // TODO: replace pPLUQ and "int nt", by PLUQ and a Parallel Helper ...
+    // Recursive 2x2 splitting: pPLUQ now uses the tiled PLUQ below
     template<class Field>
     inline size_t
     PLUQ (const Field& Fi, const FFLAS::FFLAS_DIAG Diag, const size_t M, const size_t N,
@@ -129,7 +129,7 @@ namespace FFPACK {
         }
 
 #ifdef __FFLASFFPACK_PLUQ_THRESHOLD
-        if (std::min(M,N) < __FFLASFFPACK_PLUQ_THRESHOLD)
+        if (std::min(M,N) < FFLAS::tuning().PluqThreshold)
             return PLUQ_basecaseCrout (Fi, Diag, M, N, A, lda, P, Q);
 #endif
         FFLAS::FFLAS_DIAG OppDiag = (Diag == FFLAS::FflasUnit)? FFLAS::FflasNonUnit : FFLAS::FflasUnit;
@@ -223,12 +223,16 @@ namespace FFPACK {
                     TASK(MODE(CONSTREFERENCE(Fi, A3, A2, A4, MMParH) READ(M2, N2, R1, A3[0], A2[0]) READWRITE(A4[0])),
                          fgemm( Fi, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, M-M2, N-N2, R1, Fi.mOne, A3, lda, A2, lda, Fi.one, A4, lda, MMParH));
 
-                    CHECK_DEPENDENCIES;
+                    // R2 and R3 locate the blocks of H below: a true barrier
+                    WAIT;
+
+                    typename Field::Element_ptr R = A4 + R2 + R3*lda;
+                    typename Field::Element_ptr temp = FFLAS::fflas_new (Fi, R3, R2);
 
                     // [ H1 H2 ] <- P3^T H Q2^T
                     // [ H3 H4 ]
                     PermParH.set_numthreads(std::max(nt,1));
-                    TASK(MODE(READ(P3, Q2) CONSTREFERENCE(Fi, A4, Q2, P3) READWRITE(A4[0])),
+                    TASK(MODE(READ(P3, Q2) CONSTREFERENCE(Fi, A4, Q2, P3) READWRITE(A4[0], A4[R2], A4[R3*lda], R[0])),
                          applyP( Fi, FFLAS::FflasRight, FFLAS::FflasTrans, M-M2, 0, N-N2, A4, lda, Q2, PermParH);
                          applyP( Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, N-N2, 0, M-M2, A4, lda, P3, PermParH););
 
@@ -257,15 +261,12 @@ namespace FFPACK {
 
                     // I <- H1 U2^-1
                     // K <- H3 U2^-1
-                    TASK(MODE(READ(R2, F[0]) CONSTREFERENCE(Fi, A4, F, TRSMParH, R2) READWRITE(A4[0])),
+                    TASK(MODE(READ(R2, F[0]) CONSTREFERENCE(Fi, A4, F, TRSMParH, R2) READWRITE(A4[0], A4[R3*lda])),
                          ftrsm( Fi, FFLAS::FflasRight, FFLAS::FflasUpper, FFLAS::FflasNoTrans, Diag, M-M2, R2, Fi.one, F, lda, A4, lda, TRSMParH));
 
                     CHECK_DEPENDENCIES;
 
-                    typename Field::Element_ptr temp = 0;
-
-                    TASK(MODE(READ(A4[0], R3) READWRITE(temp[0], R2) CONSTREFERENCE(Fi, A4, temp, R2, R3)),
-                         temp = FFLAS::fflas_new (Fi, R3, R2);
+                    TASK(MODE(READ(A4[0], R3, R2) WRITE(temp[0]) CONSTREFERENCE(Fi, A4, temp, R2, R3)),
                          FFLAS::fassign (Fi, R3, R2, A4, lda, temp, R2);
                         );
                     CHECK_DEPENDENCIES;
@@ -287,10 +288,8 @@ namespace FFPACK {
                          temp=0;
                         );
 
-                    typename Field::Element_ptr R = 0;
                     // R <- H4 - K V2
                     TASK(MODE(READ(R2, R3, M2, N2, A4[R3*lda], F[R2]) CONSTREFERENCE(Fi, R, F, R2, R3, MMParH) READWRITE(R[0])),
-                         R = A4 + R2 + R3*lda;
                          fgemm( Fi, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, M-M2-R3, N-N2-R2, R2, Fi.mOne, A4+R3*lda, lda, F+R2, lda, Fi.one, R, lda, MMParH)
                         );
 
@@ -310,12 +309,13 @@ namespace FFPACK {
                     // H4 = P4 [ L4 ] [ U4 V4 ] Q4
                     //         [ M4 ]
                     //TASK(READ(Fi), NOWRITE(R4), READWRITE(R, P4, Q4), PPLUQ, R4, Fi, Diag, M-M2-R3, N-N2-R2, R, lda, P4, Q4);
+                    P4 = FFLAS::fflas_new<size_t>(M-M2-R3);
+                    Q4 = FFLAS::fflas_new<size_t>(N-N2-R2);
                     TASK(MODE(CONSTREFERENCE(Fi, R4, R, P4, Q4, R2, R3, M2, N2,PSHelper) READWRITE(R[0]) WRITE(R4, P4[0], Q4[0])),
-                         P4 = FFLAS::fflas_new<size_t>(M-M2-R3);
-                         Q4 = FFLAS::fflas_new<size_t>(N-N2-R2);
                          R4 = PLUQ (Fi, Diag, M-M2-R3, N-N2-R2, R, lda, P4, Q4, PSHelper);
                         );
-                    CHECK_DEPENDENCIES;
+                    // the permutations below span blocks written by several of the tasks above
+                    WAIT;
 
                     PermParH.set_numthreads(std::max(nt/2,1));
                     // [ E21 M31 0 K1 ] <- P4^T [ E2 M3 0 K ]
@@ -407,6 +407,150 @@ namespace FFPACK {
                     //#endif
     }
 
+    template<class Field>
+    inline size_t
+    PLUQ (const Field& Fi, const FFLAS::FFLAS_DIAG Diag, const size_t M, const size_t N,
+          typename Field::Element_ptr A, const size_t lda, size_t* P, size_t* Q,
+          const FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Column,
+                                              FFLAS::StrategyParameter::Threads>& PSHelper,
+          const size_t TileSize)
+    {
+        typedef typename Field::Element_ptr Element_ptr;
+        const size_t nb = std::max (TileSize, (size_t) 1);
+        const size_t ntiles = (N + nb - 1) / nb;
+        if (PSHelper.numthreads() <= 1 || ntiles < 2 || M < 2)
+            return PLUQ (Fi, Diag, M, N, A, lda, P, Q);
+
+        const FFLAS::FFLAS_DIAG OppDiag = (Diag == FFLAS::FflasUnit)? FFLAS::FflasNonUnit : FFLAS::FflasUnit;
+        // rank of each panel and first row of its pivots, set when the panel is factored
+        std::vector<size_t> rk (ntiles, 0), roff (ntiles+1, 0);
+        size_t* rkp = rk.data();
+        size_t* roffp = roff.data();
+        // column transpositions of each panel, local to its tile
+        size_t* Qt = FFLAS::fflas_new<size_t> (N);
+
+        auto tfirst = [=] (size_t t) -> size_t { return t * nb; };
+        auto tsize = [=] (size_t t) -> size_t { return std::min (nb, N - t * nb); };
+
+        // PLUQ of the panel t, below the pivot rows of the previous panels
+        auto panel = [=, &Fi] (size_t t) {
+            const size_t s = tfirst (t), w = tsize (t), r = roffp[t], m = M - r;
+            Element_ptr At = A + r*lda + s;
+            size_t rp = 0;
+            for (size_t j = 0; j < w; ++j) Qt[s+j] = j;
+            if (m) {
+                size_t* Pt = FFLAS::fflas_new<size_t> (m);
+                size_t* Perm = FFLAS::fflas_new<size_t> (m);
+                size_t* Cur = FFLAS::fflas_new<size_t> (m);
+                rp = PLUQ (Fi, Diag, m, w, At, lda, Pt, Qt+s);
+                // the Schur complement of the panel is zero
+                FFLAS::fzero (Fi, m-rp, w-rp, At + rp*(lda+1), lda);
+                // Only the first rp row transpositions are kept, so that the ones of
+                // the next panels do not overlap them: the rows of L below the pivots
+                // are reordered accordingly
+                LAPACKPerm2MathPerm (Perm, Pt, m);
+                MathPerm2LAPACKPerm (Pt, Perm, m);
+                for (size_t i = rp; i < m; ++i) Pt[i] = i;
+                for (size_t i = 0; i < rp; ++i) P[r+i] = r + Pt[i];
+                LAPACKPerm2MathPerm (Cur, Pt, m);
+                if (rp && rp < m) {
+                    size_t* Inv = Pt;
+                    for (size_t i = 0; i < m; ++i) Inv[Perm[i]] = i;
+                    Element_ptr T = FFLAS::fflas_new (Fi, m-rp, rp);
+                    for (size_t i = rp; i < m; ++i)
+                        FFLAS::fassign (Fi, rp, At + Inv[Cur[i]]*lda, 1, T + (i-rp)*rp, 1);
+                    FFLAS::fassign (Fi, m-rp, rp, T, rp, At + rp*lda, lda);
+                    FFLAS::fflas_delete (T);
+                }
+                FFLAS::fflas_delete (Cur);
+                FFLAS::fflas_delete (Perm);
+                FFLAS::fflas_delete (Pt);
+            }
+            // the pivot rows of the previous panels follow the column permutation
+            applyP (Fi, FFLAS::FflasRight, FFLAS::FflasTrans, r, 0, w, A + s, lda, Qt+s);
+            rkp[t] = rp;
+            roffp[t+1] = r + rp;
+        };
+        // update of the tile j by the panel t: row permutation, U block and Schur complement
+        auto update = [=, &Fi] (size_t j, size_t t) {
+            const size_t s = tfirst (t), sj = tfirst (j), wj = tsize (j);
+            const size_t r = roffp[t], rp = rkp[t];
+            if (!rp) return;
+            applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, wj, r, r+rp, A + sj, lda, P);
+            FFLAS::ftrsm (Fi, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, OppDiag,
+                          rp, wj, Fi.one, A + r*lda + s, lda, A + r*lda + sj, lda);
+            FFLAS::fgemm (Fi, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, M-r-rp, wj, rp, Fi.mOne,
+                          A + (r+rp)*lda + s, lda, A + r*lda + sj, lda,
+                          Fi.one, A + (r+rp)*lda + sj, lda);
+        };
+        // row transpositions of the later panels on the L part of the panel t
+        auto swapL = [=, &Fi] (size_t t) {
+            applyP (Fi, FFLAS::FflasLeft, FFLAS::FflasNoTrans, rkp[t], roffp[t+1], roffp[ntiles],
+                    A + tfirst (t), lda, P);
+        };
+
+        SYNCH_GROUP(
+                    TASK(MODE(CONSTREFERENCE(panel) READWRITE(A[0])), panel (0));
+                    CHECK_DEPENDENCIES;
+                    for (size_t t = 0; t + 1 < ntiles; ++t) {
+                    Element_ptr At = A + tfirst (t);
+                    Element_ptr An = A + tfirst (t+1);
+                    // lookahead: the next panel is updated and factored first
+                    TASK(MODE(CONSTREFERENCE(update, panel) READ(At[0]) READWRITE(An[0])),
+                         update (t+1, t); panel (t+1));
+                    for (size_t j = t+2; j < ntiles; ++j) {
+                    Element_ptr Aj = A + tfirst (j);
+                    TASK(MODE(CONSTREFERENCE(update) READ(At[0]) READWRITE(Aj[0])), update (j, t));
+                    }
+                    CHECK_DEPENDENCIES;
+                    }
+                    // swapL reads the transpositions of all the later panels
+                    WAIT;
+                    for (size_t t = 0; t + 1 < ntiles; ++t) {
+                    Element_ptr At = A + tfirst (t);
+                    TASK(MODE(CONSTREFERENCE(swapL) READWRITE(At[0])), swapL (t));
+                    }
+                   );
+
+        const size_t R = roff[ntiles];
+        for (size_t i = R; i < M; ++i) P[i] = i;
+
+        // Q: the pivot columns of the panels in order, then their other columns
+        size_t* MathQ = FFLAS::fflas_new<size_t> (N);
+        size_t* Loc = FFLAS::fflas_new<size_t> (nb);
+        size_t* Src = FFLAS::fflas_new<size_t> (N);
+        size_t ip = 0, inp = R;
+        bool moved = false;
+        for (size_t t = 0; t < ntiles; ++t) {
+            const size_t s = tfirst (t), w = tsize (t);
+            LAPACKPerm2MathPerm (Loc, Qt+s, w);
+            for (size_t j = 0; j < w; ++j) {
+                size_t& k = (j < rk[t]) ? ip : inp;
+                MathQ[k] = s + Loc[j];
+                Src[k] = s + j;
+                moved |= (k != s + j);
+                ++k;
+            }
+        }
+        // move the pivot columns of all panels to the left
+        if (moved) {
+            Element_ptr T = FFLAS::fflas_new (Fi, 1, N);
+            for (size_t i = 0; i < M; ++i) {
+                Element_ptr Ai = A + i*lda;
+                for (size_t k = 0; k < N; ++k)
+                    Fi.assign (T[k], Ai[Src[k]]);
+                FFLAS::fassign (Fi, N, T, 1, Ai, 1);
+            }
+            FFLAS::fflas_delete (T);
+        }
+        MathPerm2LAPACKPerm (Q, MathQ, N);
+        FFLAS::fflas_delete (Src);
+        FFLAS::fflas_delete (Loc);
+        FFLAS::fflas_delete (MathQ);
+        FFLAS::fflas_delete (Qt);
+        return R;
+    }
+
     template<class Field>
     inline size_t
     pPLUQ (const Field& Fi, const FFLAS::FFLAS_DIAG Diag,
@@ -414,7 +558,7 @@ namespace FFPACK {
           typename Field::Element_ptr A, size_t lda, size_t*P, size_t *Q)
     {
         size_t r;
-        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+        FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Column,
                                     FFLAS::StrategyParameter::Threads> PSHelper;
         PAR_BLOCK{
             PSHelper.set_numthreads(NUM_THREADS);
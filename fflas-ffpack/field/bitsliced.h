@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file field/bitsliced.h
+ * @brief GF(2) and GF(3) with bit-sliced dense storage.
+ *
+ * The entries of a matrix are stored by groups of 64 consecutive entries
+ * (along its rows), each group taking one 64-bit word per plane: GF(2) has
+ * one plane, GF(3) has two, with the one-hot encoding bit of plane 0 for 1 and
+ * bit of plane 1 for 2. A matrix is allocated by fflas_new(F,m,n) and accessed
+ * through the proxy pointers Element_ptr, as in the RNS fields, with the
+ * usual A+i*lda+j arithmetic; an lda multiple of 64 keeps the rows aligned.
+ *
+ * FFLAS::fgemm, FFLAS::ftrsm, FFPACK::PLUQ, FFPACK::Rank, FFPACK::Det and
+ * the row echelon forms are overloaded for these fields, with kernels
+ * working on whole words (fflas_bitsliced.inl and ffpack_bitsliced.inl).
+ */
+
+#ifndef __FFLASFFPACK_field_bitsliced_H
+#define __FFLASFFPACK_field_bitsliced_H
+
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include "fflas-ffpack/fflas-ffpack-config.h"
+#include "fflas-ffpack/utils/fflas_memory.h"
+#include "fflas-ffpack/field/field-traits.h"
+
+namespace FFPACK {
+
+    //! Reference to an entry of a bit-sliced matrix
+    template<size_t Planes>
+    struct bitsliced_ref {
+        uint64_t* _ptr; // plane 0 word of the group of the entry
+        size_t    _bit; // position of the entry in the group
+
+        bitsliced_ref (uint64_t* p, size_t b) : _ptr(p), _bit(b) {}
+        operator uint8_t() const {
+            uint8_t v = 0;
+            for (size_t k = 0; k < Planes; ++k)
+                if ((_ptr[k] >> _bit) & 1) v = uint8_t(k+1);
+            return v;
+        }
+        bitsliced_ref& operator= (const uint8_t v) {
+            for (size_t k = 0; k < Planes; ++k)
+                _ptr[k] = (_ptr[k] & ~(UINT64_C(1) << _bit)) | (uint64_t(v == k+1) << _bit);
+            return *this;
+        }
+        bitsliced_ref& operator= (const bitsliced_ref& x) { return *this = uint8_t(x); }
+    };
+
+    //! Pointer to an entry of a bit-sliced matrix
+    template<size_t Planes>
+    struct bitsliced_ptr {
+        uint64_t* _ptr; // plane 0 word of the group of the entry
+        size_t    _bit; // position of the entry in the group
+
+        bitsliced_ptr () : _ptr(nullptr), _bit(0) {}
+        bitsliced_ptr (uint64_t* p, size_t b = 0) : _ptr(p + Planes*(b >> 6)), _bit(b & 63) {}
+        inline bitsliced_ref<Planes> operator* () const { return bitsliced_ref<Planes>(_ptr, _bit); }
+        inline bitsliced_ref<Planes> operator[] (size_t i) const { return *(*this + i); }
+        inline bitsliced_ptr  operator+ (size_t i) const { return bitsliced_ptr(_ptr, _bit + i); }
+        inline bitsliced_ptr& operator+= (size_t i) { return *this = *this + i; }
+        inline bitsliced_ptr& operator++ () { return *this += 1; }
+        bool operator== (const bitsliced_ptr& x) const { return _ptr == x._ptr && _bit == x._bit; }
+        bool operator!= (const bitsliced_ptr& x) const { return !(*this == x); }
+    };
+
+    /** Operations on the words of a group of 64 entries, one word per plane.
+     * The ops on masks only change the entries selected by the mask.
+     */
+    template<uint64_t Q>
+    struct BitSlicedWords;
+
+    template<>
+    struct BitSlicedWords<2> {
+        static const size_t planes = 1;
+        //! number of rows combined in the tables of the Four Russians kernels
+        static const size_t grease = 8;
+
+        static inline void zero (uint64_t* x) { x[0] = 0; }
+        //! x <- x + c.y
+        static inline void axpyin (uint64_t* x, const uint8_t c, const uint64_t* y) { if (c) x[0] ^= y[0]; }
+        //! x <- c.x
+        static inline void scalin (uint64_t* x, const uint8_t c) { if (!c) x[0] = 0; }
+        //! x <- y on mask
+        static inline void select (uint64_t* x, const uint64_t* y, const uint64_t mask) { x[0] ^= (x[0] ^ y[0]) & mask; }
+        static inline uint8_t get (const uint64_t* x, const size_t j) { return (x[0] >> j) & 1; }
+        static inline void set (uint64_t* x, const size_t j, const uint8_t v) {
+            x[0] = (x[0] & ~(UINT64_C(1) << j)) | (uint64_t(v) << j);
+        }
+        //! sum of the products of the entries of x and y on mask
+        static inline uint8_t dot (const uint64_t* x, const uint64_t* y, const uint64_t mask) {
+            return __builtin_popcountll (x[0] & y[0] & mask) & 1;
+        }
+        //! the g first entries of x as the digits of an integer in base 2
+        static inline size_t index (const uint64_t* x, const size_t g) {
+            return x[0] & ((UINT64_C(1) << g) - 1);
+        }
+    };
+
+    template<>
+    struct BitSlicedWords<3> {
+        static const size_t planes = 2;
+        static const size_t grease = 5;
+
+        static inline void zero (uint64_t* x) { x[0] = x[1] = 0; }
+        static inline void addin (uint64_t* x, const uint64_t y0, const uint64_t y1) {
+            const uint64_t xz = ~(x[0] | x[1]), yz = ~(y0 | y1);
+            const uint64_t r0 = (x[0] & yz) | (y0 & xz) | (x[1] & y1);
+            const uint64_t r1 = (x[1] & yz) | (y1 & xz) | (x[0] & y0);
+            x[0] = r0; x[1] = r1;
+        }
+        static inline void axpyin (uint64_t* x, const uint8_t c, const uint64_t* y) {
+            if (c == 1) addin (x, y[0], y[1]);
+            else if (c == 2) addin (x, y[1], y[0]);
+        }
+        static inline void scalin (uint64_t* x, const uint8_t c) {
+            if (!c) x[0] = x[1] = 0;
+            else if (c == 2) std::swap (x[0], x[1]);
+        }
+        static inline void select (uint64_t* x, const uint64_t* y, const uint64_t mask) {
+            x[0] ^= (x[0] ^ y[0]) & mask;
+            x[1] ^= (x[1] ^ y[1]) & mask;
+        }
+        static inline uint8_t get (const uint64_t* x, const size_t j) {
+            return uint8_t(((x[0] >> j) & 1) | (((x[1] >> j) & 1) << 1));
+        }
+        static inline void set (uint64_t* x, const size_t j, const uint8_t v) {
+            const uint64_t b = UINT64_C(1) << j;
+            x[0] = (x[0] & ~b) | (uint64_t(v == 1) << j);
+            x[1] = (x[1] & ~b) | (uint64_t(v == 2) << j);
+        }
+        static inline uint8_t dot (const uint64_t* x, const uint64_t* y, const uint64_t mask) {
+            const int n1 = __builtin_popcountll (x[0] & y[0] & mask) + __builtin_popcountll (x[1] & y[1] & mask);
+            const int n2 = __builtin_popcountll (x[0] & y[1] & mask) + __builtin_popcountll (x[1] & y[0] & mask);
+            return uint8_t((n1 + 2*n2) % 3);
+        }
+        static inline size_t index (const uint64_t* x, const size_t g) {
+            size_t idx = 0;
+            for (size_t t = g; t--; )
+                idx = 3*idx + get (x, t);
+            return idx;
+        }
+    };
+
+    /** \brief GF(Q), Q = 2 or 3, with bit-sliced matrices.
+     *
+     * The elements are the integers 0..Q-1 in an uint8_t; the scalar
+     * interface is that of the Givaro fields.
+     */
+    template<uint64_t Q>
+    class BitSliced : public BitSlicedWords<Q> {
+    public:
+        typedef BitSlicedWords<Q>             Words;
+        typedef uint8_t                     Element;
+        typedef bitsliced_ptr<Words::planes> Element_ptr;
+        typedef bitsliced_ptr<Words::planes> ConstElement_ptr;
+        typedef uint64_t                    Residu_t;
+
+        const Element zero, one, mOne;
+
+        BitSliced () : zero(0), one(1), mOne(Element(Q-1)) {}
+        BitSliced (const Residu_t p) : BitSliced() {
+            if (p != Q) throw std::invalid_argument ("BitSliced: wrong characteristic");
+        }
+        BitSliced (const BitSliced&) : BitSliced() {}
+
+        Residu_t characteristic () const { return Q; }
+        template<class T> T& characteristic (T& p) const { return p = T(Q); }
+        Residu_t cardinality () const { return Q; }
+        template<class T> T& cardinality (T& p) const { return p = T(Q); }
+        Residu_t minElement () const { return 0; }
+        Residu_t maxElement () const { return Q-1; }
+
+        Element& init (Element& x) const { return x = 0; }
+        template<class T> Element& init (Element& x, const T& v) const {
+            const int64_t r = int64_t(v) % int64_t(Q);
+            return x = Element(r < 0 ? r + int64_t(Q) : r);
+        }
+        template<class T> T& convert (T& x, const Element& y) const { return x = T(y); }
+        Element& assign (Element& x, const Element& y) const { return x = y; }
+        Element& reduce (Element& x) const { return x = Element(x % Q); }
+
+        bool isZero (const Element& x) const { return x == 0; }
+        bool isOne (const Element& x) const { return x == 1; }
+        bool isMOne (const Element& x) const { return x == Q-1; }
+        bool isUnit (const Element& x) const { return x != 0; }
+        bool areEqual (const Element& x, const Element& y) const { return x == y; }
+
+        Element& add (Element& r, const Element& a, const Element& b) const { return r = Element((a+b) % Q); }
+        Element& sub (Element& r, const Element& a, const Element& b) const { return r = Element((a+Q-b) % Q); }
+        Element& neg (Element& r, const Element& a) const { return r = Element((Q-a) % Q); }
+        Element& mul (Element& r, const Element& a, const Element& b) const { return r = Element((a*b) % Q); }
+        // the units of GF(2) and GF(3) are their own inverses
+        Element& inv (Element& r, const Element& a) const { return r = a; }
+        Element& div (Element& r, const Element& a, const Element& b) const { return mul (r, a, b); }
+        Element& axpy (Element& r, const Element& a, const Element& x, const Element& y) const { return r = Element((a*x+y) % Q); }
+        Element& axmy (Element& r, const Element& a, const Element& x, const Element& y) const { return r = Element((a*x+Q-y) % Q); }
+        Element& maxpy (Element& r, const Element& a, const Element& x, const Element& y) const { return r = Element((y+Q*Q-a*x) % Q); }
+
+        Element& addin (Element& r, const Element& a) const { return add (r, r, a); }
+        Element& subin (Element& r, const Element& a) const { return sub (r, r, a); }
+        Element& negin (Element& r) const { return neg (r, r); }
+        Element& mulin (Element& r, const Element& a) const { return mul (r, r, a); }
+        Element& invin (Element& r) const { return r; }
+        Element& divin (Element& r, const Element& a) const { return mul (r, r, a); }
+        Element& axpyin (Element& r, const Element& a, const Element& x) const { return axpy (r, a, x, r); }
+        Element& maxpyin (Element& r, const Element& a, const Element& x) const { return maxpy (r, a, x, r); }
+
+        std::ostream& write (std::ostream& os) const { return os << "BitSliced GF(" << Q << ")"; }
+        std::ostream& write (std::ostream& os, const Element& x) const { return os << int(x); }
+        std::istream& read (std::istream& is, Element& x) const { int64_t v; is >> v; init (x, v); return is; }
+
+        class RandIter {
+            std::mt19937_64 _gen;
+        public:
+            RandIter (const BitSliced&, uint64_t seed = 0) : _gen(seed) {}
+            Element& random (Element& x) { return x = Element(_gen() % Q); }
+            Element& operator() (Element& x) { return random (x); }
+            Element random () { Element x; return random (x); }
+            //! nonzero element
+            Element& nonzerorandom (Element& x) { return x = Element(1 + _gen() % (Q-1)); }
+        };
+    };
+
+    typedef BitSliced<2> GF2;
+    typedef BitSliced<3> GF3;
+
+} // FFPACK
+
+namespace FFLAS {
+
+    //! Groups of 64 entries needed to store m entries
+    inline size_t bitsliced_groups (const size_t m) { return (m + 63) >> 6; }
+
+    template<uint64_t Q>
+    inline typename FFPACK::BitSliced<Q>::Element_ptr
+    fflas_new (const FFPACK::BitSliced<Q>& F, const size_t m, const Alignment align = Alignment::CACHE_LINE)
+    {
+        const size_t words = FFPACK::BitSliced<Q>::planes * bitsliced_groups (m);
+        uint64_t* ptr = fflas_new<uint64_t> (std::max (words, size_t(1)), align);
+        std::fill (ptr, ptr + words, UINT64_C(0));
+        return typename FFPACK::BitSliced<Q>::Element_ptr (ptr);
+    }
+
+    //! The rows of the m x n matrix are padded to whole groups: use n rounded up to 64 as lda
+    template<uint64_t Q>
+    inline typename FFPACK::BitSliced<Q>::Element_ptr
+    fflas_new (const FFPACK::BitSliced<Q>& F, const size_t m, const size_t n, const Alignment align = Alignment::CACHE_LINE)
+    {
+        return fflas_new (F, m * (bitsliced_groups (n) << 6), align);
+    }
+
+    template<size_t Planes>
+    inline void fflas_delete (FFPACK::bitsliced_ptr<Planes> A) { fflas_delete (A._ptr); }
+
+} // FFLAS
+
+#include "fflas-ffpack/fflas/fflas_bitsliced.inl"
+#include "fflas-ffpack/ffpack/ffpack_bitsliced.inl"
+
+#endif // __FFLASFFPACK_field_bitsliced_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -69,6 +69,9 @@ namespace FFPACK {
     template<class T>
     class RNSIntegerMod;
 
+    template<uint64_t Q>
+    class BitSliced;
+
 }
 
 namespace FFLAS { /*  Categories */
@@ -84,6 +87,8 @@ namespace FFLAS { /*  Categories */
         struct ModularTag{};
         //! If the field uses a representation with infix operators
         struct UnparametricTag{};
+        //! This is a small prime field packing 64 entries per machine word, like <code>BitSliced<Q></code>
+        struct BitSlicedTag{};
     }
 
     //! Specifies the mode of action for an algorithm w.r.t. its field
@@ -310,6 +315,12 @@ namespace FFLAS { /*  Traits */
         // typedef true_type balanced ;
         static  const bool balanced = false ;
     };
+    // BitSliced
+    template<uint64_t Q>
+    struct FieldTraits<FFPACK::BitSliced<Q> >{
+        typedef FieldCategories::BitSlicedTag category;
+        static  const bool balanced = false ;
+    };
 
 
 } // FFLAS
@@ -224,9 +224,19 @@ namespace FFPACK {
         void convert(size_t m, size_t n, integer gamma, integer* A, size_t lda, const double* Arns, size_t rda, bool RNS_MAJOR=false) const;
         void convert_transpose(size_t m, size_t n, integer gamma, integer* A, size_t lda, const double* Arns, size_t rda, bool RNS_MAJOR=false) const;
 
+        // same as above, the Kronecker split and the products by the CRT matrices
+        // running along psH (Sequential for the blocks of a parallel conversion)
+        template<class ParSeq>
+        void init(size_t m, size_t n, double* Arns, size_t rda, const integer* A, size_t lda, size_t k, bool RNS_MAJOR, const ParSeq& psH) const;
+        template<class ParSeq>
+        void convert(size_t m, size_t n, integer gamma, integer* A, size_t lda, const double* Arns, size_t rda, bool RNS_MAJOR, const ParSeq& psH) const;
+
         // reduce entries of Arns to be less than the rns basis elements
         void reduce(size_t n, double* Arns, size_t rda, bool RNS_MAJOR=false) const;
 
+        // res = sum_l A_beta[l].2^(16l) for the _ldm chunk sums A_beta of an entry
+        void kronecker_sum(integer& res, const double* A_beta) const;
+
         template<size_t K>
         void init(size_t m, size_t n, double* Arns, size_t rda, const RecInt::ruint<K>* A, size_t lda, size_t k, bool RNS_MAJOR=false) const;
         template<size_t K>
@@ -35,6 +35,13 @@ namespace FFPACK {
     // Arns must be an array of m*n*_size
     // abs(||A||) < 2^(16k)
     inline void rns_double::init(size_t m, size_t n, double* Arns, size_t rda, const integer* A, size_t lda, size_t k, bool RNS_MAJOR) const
+    {
+        init(m,n,Arns,rda,A,lda,k,RNS_MAJOR,
+             FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive>());
+    }
+
+    template<class ParSeq>
+    inline void rns_double::init(size_t m, size_t n, double* Arns, size_t rda, const integer* A, size_t lda, size_t k, bool RNS_MAJOR, const ParSeq& psH) const
     {
         if (k>_ldm){
             FFPACK::failure()(__func__,__FILE__,__LINE__,"rns_double [init] -> rns basis is too small to handle integers with 2^(16*k) values ");
@@ -58,7 +65,7 @@ namespace FFPACK {
         //for(size_t i=0;i<m;i++)
         //PAR_BLOCK{
         //			FOR1D(i,m,sp,
-        PARFOR1D(i,m,SPLITTER(NUM_THREADS),
+        PARFOR1D(i,m,SPLITTER(psH.numthreads()),
 
                  for(size_t j=0;j<n;j++){
                  size_t idx=j+i*n;
@@ -101,7 +108,7 @@ namespace FFPACK {
             Givaro::Timer tfgemm; tfgemm.start();
 #ifndef ENABLE_CHECKER_fgemm
             FFLAS::fgemm (Givaro::ZRing<double>(), FFLAS::FflasNoTrans,FFLAS::FflasTrans,_size,mn,k,1.0,_crt_in.data(),_ldm,A_beta,k,0.,Arns,rda,
-                          FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive>());
+                          psH);
 #else
             cblas_dgemm(CblasRowMajor,CblasNoTrans,CblasTrans,(int)_size,(int)mn,(int)k,1.0,_crt_in.data(),(int)_ldm,A_beta,(int)k,0.,Arns,(int)rda);
 #endif
@@ -112,7 +119,7 @@ namespace FFPACK {
             // Arns =  A_beta x _crt_in^T
 #ifndef ENABLE_CHECKER_fgemm
             FFLAS::fgemm (Givaro::ZRing<double>(), FFLAS::FflasNoTrans,FFLAS::FflasTrans,mn,_size,k,1.0,A_beta, k, _crt_in.data(),_ldm,0.,Arns,_size,
-                          FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive>());
+                          psH);
 #else
             cblas_dgemm(CblasRowMajor,CblasNoTrans,CblasTrans,(int)mn,(int)_size,(int)k,1.0,A_beta,(int)k,_crt_in.data(),(int)_ldm,0.,Arns,(int)_size);
 #endif
@@ -224,6 +231,14 @@ namespace FFPACK {
 
     inline void rns_double::convert(size_t m, size_t n, integer gamma, integer* A, size_t lda,
                                     const double* Arns, size_t rda, bool RNS_MAJOR) const
+    {
+        convert(m,n,gamma,A,lda,Arns,rda,RNS_MAJOR,
+                FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive>());
+    }
+
+    template<class ParSeq>
+    inline void rns_double::convert(size_t m, size_t n, integer gamma, integer* A, size_t lda,
+                                    const double* Arns, size_t rda, bool RNS_MAJOR, const ParSeq& psH) const
     {
         const size_t  mn= m*n;
         if (mn) {
@@ -240,14 +255,14 @@ namespace FFPACK {
         Givaro::Timer tfgemmc;tfgemmc.start();
         if (RNS_MAJOR==false) {// compute A_beta = Ap^T x M_beta
 #ifndef ENABLE_CHECKER_fgemm
-            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasTrans, FFLAS::FflasNoTrans, mn, _ldm, _size, 1.0 , Arns, rda, _crt_out.data(), _ldm, 0., A_beta,_ldm, FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive >());
+            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasTrans, FFLAS::FflasNoTrans, mn, _ldm, _size, 1.0 , Arns, rda, _crt_out.data(), _ldm, 0., A_beta,_ldm, psH);
 #else
             cblas_dgemm(CblasRowMajor,CblasTrans, CblasNoTrans, (int)mn, (int)_ldm, (int)_size, 1.0 , Arns, (int)rda, _crt_out.data(), (int)_ldm, 0., A_beta,(int)_ldm);
 #endif
         }
         else  {// compute A_beta = Ap x M_Beta
 #ifndef ENABLE_CHECKER_fgemm
-            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, mn, _ldm, _size, 1.0 , Arns, _size, _crt_out.data(), _ldm, 0., A_beta, _ldm, FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,FFLAS::StrategyParameter::TwoDAdaptive >());
+            FFLAS::fgemm(Givaro::ZRing<double>(),FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, mn, _ldm, _size, 1.0 , Arns, _size, _crt_out.data(), _ldm, 0., A_beta, _ldm, psH);
 #else
             cblas_dgemm(CblasRowMajor,CblasNoTrans, CblasNoTrans, (int)mn, (int)_ldm, (int)_size, 1.0 , Arns, (int)_size, _crt_out.data(), (int)_ldm, 0., A_beta,(int)_ldm);
 #endif
@@ -256,78 +271,34 @@ namespace FFPACK {
         //if(m>1 && n>1) std::cerr<<"fgemm Convert : "<<tfgemmc.realtime()<<std::endl;
         // compute A using inverse Kronecker transform of A_beta expressed in base 2^log_beta
         integer* Aiter= A;
-        size_t k=_ldm;
-        size_t k4=((k+3)>>2)+ (((k+3)%4==0)?0:1);
-        std::vector<uint16_t> A0(k4<<2,0),A1(k4<<2,0),A2(k4<<2,0),A3(k4<<2,0);
-        integer a0,a1,a2,a3,res;
-        mpz_t *m0,*m1,*m2,*m3;
-        m0= reinterpret_cast<mpz_t*>(&a0);
-        m1= reinterpret_cast<mpz_t*>(&a1);
-        m2= reinterpret_cast<mpz_t*>(&a2);
-        m3= reinterpret_cast<mpz_t*>(&a3);
-        mp_limb_t *m0_d,*m1_d,*m2_d,*m3_d;
-        m0_d = m0[0]->_mp_d;
-        m1_d = m1[0]->_mp_d;
-        m2_d = m2[0]->_mp_d;
-        m3_d = m3[0]->_mp_d;
-        m0[0]->_mp_alloc = m1[0]->_mp_alloc = m2[0]->_mp_alloc = m3[0]->_mp_alloc = (int) (k4*8/sizeof(mp_limb_t)); // to ensure 32 bits portability
-        m0[0]->_mp_size  = m1[0]->_mp_size  = m2[0]->_mp_size  = m3[0]->_mp_size  = (int) (k4*8/sizeof(mp_limb_t)); // to ensure 32 bits portability
         Givaro::Timer tkroc;
         tkroc.start();
-        //		auto sp=SPLITTER();
-        //		PARFOR1D(i,m,sp,
-        for(size_t i=0;i<m;i++)
-            for (size_t j=0;j<n;j++){
-                size_t idx=i*n+j;
-                for (size_t l=0;l<k;l++){
-                    uint64_t tmp=(uint64_t)A_beta[l+idx*k];
-                    uint16_t* tptr= reinterpret_cast<uint16_t*>(&tmp);
-#ifdef __FFLASFFPACK_HAVE_LITTLE_ENDIAN
-                    A0[l  ]= tptr[0];
-                    A1[l+1]= tptr[1];
-                    A2[l+2]= tptr[2];
-                    A3[l+3]= tptr[3];
-#else
-                    A0[l     ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[3];
-                    A1[(l+1) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[2];
-                    A2[(l+2) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[1];
-                    A3[(l+3) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[0];
-#endif
-                }
-                // see A0,A1,A2,A3 as a the gmp integers a0,a1,a2,a3
-                m0[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A0[0]);
-                m1[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A1[0]);
-                m2[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A2[0]);
-                m3[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A3[0]);
-                res = a0;res+= a1;res+= a2;res+= a3;
-                res%=_M;
-
-                // get the correct result according to the expected sign of A
-                if (res>hM)
-                    res-=_M;
-                if (gamma==0)
-                    Aiter[j+i*lda]=res;
-                else
-                    if (gamma==integer(1))
-                        Aiter[j+i*lda]+=res;
-                    else
-                        if (gamma==integer(-1))
-                            Aiter[j+i*lda]=res-Aiter[j+i*lda];
-                        else{
-                            Aiter[j+i*lda]*=gamma;
-                            Aiter[j+i*lda]+=res;
-                        }
-
-            }
+        PARFOR1D(i,m,SPLITTER(psH.numthreads()),
+                 integer res;
+                 for (size_t j=0;j<n;j++){
+                     kronecker_sum(res, A_beta+(i*n+j)*_ldm);
+                     res%=_M;
+
+                     // get the correct result according to the expected sign of A
+                     if (res>hM)
+                         res-=_M;
+                     if (gamma==0)
+                         Aiter[j+i*lda]=res;
+                     else
+                         if (gamma==integer(1))
+                             Aiter[j+i*lda]+=res;
+                         else
+                             if (gamma==integer(-1))
+                                 Aiter[j+i*lda]=res-Aiter[j+i*lda];
+                             else{
+                                 Aiter[j+i*lda]*=gamma;
+                                 Aiter[j+i*lda]+=res;
+                             }
+                 }
+                );
         tkroc.stop();
         //if(m>1 && n>1) std::cerr<<"Kronecker Convert : "<<tkroc.realtime()<<std::endl;
 
-        m0[0]->_mp_d = m0_d;
-        m1[0]->_mp_d = m1_d;
-        m2[0]->_mp_d = m2_d;
-        m3[0]->_mp_d = m3_d;
-        m0[0]->_mp_alloc = m1[0]->_mp_alloc = m2[0]->_mp_alloc= m3[0]->_mp_alloc = 1;
-        m0[0]->_mp_size  = m1[0]->_mp_size  = m2[0]->_mp_size = m3[0]->_mp_size  = 0;
         FFLAS::fflas_delete( A_beta);
 
 #ifdef CHECK_RNS
@@ -370,48 +341,10 @@ namespace FFPACK {
         }
         // compute A using inverse Kronecker transform of A_beta expressed in base 2^log_beta
         integer* Aiter= A;
-        size_t k=_ldm;
-        size_t k4=((k+3)>>2)+ (((k+3)%4==0)?0:1);
-        std::vector<uint16_t> A0(k4<<2,0),A1(k4<<2,0),A2(k4<<2,0),A3(k4<<2,0);
-        integer a0,a1,a2,a3,res;
-        mpz_t *m0,*m1,*m2,*m3;
-        m0= reinterpret_cast<mpz_t*>(&a0);
-        m1= reinterpret_cast<mpz_t*>(&a1);
-        m2= reinterpret_cast<mpz_t*>(&a2);
-        m3= reinterpret_cast<mpz_t*>(&a3);
-        mp_limb_t *m0_d,*m1_d,*m2_d,*m3_d;
-        m0_d = m0[0]->_mp_d;
-        m1_d = m1[0]->_mp_d;
-        m2_d = m2[0]->_mp_d;
-        m3_d = m3[0]->_mp_d;
-        m0[0]->_mp_alloc = m1[0]->_mp_alloc = m2[0]->_mp_alloc = m3[0]->_mp_alloc = (int32_t)(k4*8/sizeof(mp_limb_t)); // to ensure 32 bits portability
-        m0[0]->_mp_size  = m1[0]->_mp_size  = m2[0]->_mp_size  = m3[0]->_mp_size  = (int32_t)(k4*8/sizeof(mp_limb_t)); // to ensure 32 bits portability
+        integer res;
         for (size_t j=0;j<n;j++)
             for(size_t i=0;i<m;i++){
-
-
-                size_t idx=i+j*m;
-                for (size_t l=0;l<k;l++){
-                    uint64_t tmp=(uint64_t)A_beta[l+idx*k];
-                    uint16_t* tptr= reinterpret_cast<uint16_t*>(&tmp);
-#ifdef __FFLASFFPACK_HAVE_LITTLE_ENDIAN
-                    A0[l  ]= tptr[0];
-                    A1[l+1]= tptr[1];
-                    A2[l+2]= tptr[2];
-                    A3[l+3]= tptr[3];
-#else
-                    A0[l     ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[3];
-                    A1[(l+1) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[2];
-                    A2[(l+2) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[1];
-                    A3[(l+3) ^ ((sizeof(mp_limb_t)/2U) - 1U)] = tptr[0];
-#endif
-                }
-                // see A0,A1,A2,A3 as a the gmp integers a0,a1,a2,a3
-                m0[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A0[0]);
-                m1[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A1[0]);
-                m2[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A2[0]);
-                m3[0]->_mp_d= reinterpret_cast<mp_limb_t*>(&A3[0]);
-                res = a0;res+= a1;res+= a2;res+= a3;
+                kronecker_sum(res, A_beta+(i+j*m)*_ldm);
                 res%=_M;
 
                 // get the correct result according to the expected sign of A
@@ -429,14 +362,7 @@ namespace FFPACK {
                             Aiter[j+i*lda]*=gamma;
                             Aiter[j+i*lda]+=res;
                         }
-
             }
-        m0[0]->_mp_d = m0_d;
-        m1[0]->_mp_d = m1_d;
-        m2[0]->_mp_d = m2_d;
-        m3[0]->_mp_d = m3_d;
-        m0[0]->_mp_alloc = m1[0]->_mp_alloc = m2[0]->_mp_alloc= m3[0]->_mp_alloc = 1;
-        m0[0]->_mp_size  = m1[0]->_mp_size  = m2[0]->_mp_size = m3[0]->_mp_size  = 0;
         FFLAS::fflas_delete( A_beta);
 #ifdef CHECK_RNS
         bool ok=true;
@@ -451,6 +377,34 @@ namespace FFPACK {
         }
     }
 
+    // The chunk sums A_beta[l] are non negative integers below 2^53: their carries
+    // are propagated 16 bits at a time, the chunks being packed directly into the
+    // limbs of res, instead of adding four shifted gmp integers per entry.
+    inline void rns_double::kronecker_sum(integer& res, const double* A_beta) const
+    {
+        const size_t cpl = sizeof(mp_limb_t)/2; // 16-bit chunks per limb (32 bits portability)
+        // the carries stay below 2^38, hence the sum fits in _ldm+3 chunks
+        const size_t nl = (_ldm+3+cpl-1)/cpl;
+        mpz_ptr r = reinterpret_cast<mpz_ptr>(&res);
+        if ((size_t)r->_mp_alloc < nl)
+            _mpz_realloc(r, (mp_size_t)nl);
+        mp_limb_t* d = r->_mp_d;
+        uint64_t carry = 0;
+        for (size_t w=0, l=0; w<nl; w++){
+            mp_limb_t limb = 0;
+            for (size_t c=0; c<cpl; c++, l++){
+                if (l<_ldm)
+                    carry += (uint64_t)A_beta[l];
+                limb |= (mp_limb_t)(carry & 0xFFFFU) << (16*c);
+                carry >>= 16;
+            }
+            d[w] = limb;
+        }
+        size_t s = nl;
+        while (s && !d[s-1]) --s;
+        r->_mp_size = (int)s;
+    }
+
     // reduce entries of Arns to be less than the rns basis elements
     inline void rns_double::reduce(size_t n, double* Arns, size_t rda, bool RNS_MAJOR) const{
 
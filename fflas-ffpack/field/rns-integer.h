@@ -31,9 +31,11 @@
 #ifndef __FFPACK_unparametric_rns_integer_H
 #define __FFPACK_unparametric_rns_integer_H
 
+#include <algorithm>
 #include <givaro/givinteger.h>
 
 #include "fflas-ffpack/field/rns-double.h"
+#include "fflas-ffpack/paladin/parallel.h"
 
 namespace FFPACK {
 
@@ -182,6 +184,72 @@ namespace FFLAS {
         F.rns().convert(m,n,alpha,B,ldb,A._ptr,A._stride);
     }
 
+    // conversions along a ParSeqHelper: the RNS matrix A is stored with leading dimension n
+    template<typename RNS>
+    void finit_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n, size_t k,
+                   const Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::Element_ptr A,
+                   const ParSeqHelper::Sequential& psH)
+    {
+        F.rns().init(m,n,A._ptr,A._stride, B,ldb,k,false,psH);
+    }
+    template<typename RNS>
+    void fconvert_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n,
+                      Givaro::Integer alpha, Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::ConstElement_ptr A,
+                      const ParSeqHelper::Sequential& psH)
+    {
+        F.rns().convert(m,n,alpha,B,ldb,A._ptr,A._stride,false,psH);
+    }
+
+    // one task per block of rows, each block converted sequentially, so that
+    // the conversions scale with the dimensions and not only with the moduli
+    template<typename RNS, typename Cut, typename Param>
+    void finit_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n, size_t k,
+                   const Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::Element_ptr A,
+                   const ParSeqHelper::Parallel<Cut,Param>& psH)
+    {
+        ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> RowH(std::min(m,psH.numthreads()));
+        SYNCH_GROUP(
+                    FORBLOCK1D(iter, m, RowH,
+                               TASK(MODE(CONSTREFERENCE(F)),
+                                    finit_rns(F, iter.end()-iter.begin(), n, k, B+iter.begin()*ldb, ldb,
+                                              typename FFPACK::RNSInteger<RNS>::Element_ptr(A._ptr+iter.begin()*n,A._stride),
+                                              ParSeqHelper::Sequential());
+                                   );
+                              );
+                   );
+    }
+    template<typename RNS, typename Cut, typename Param>
+    void fconvert_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n,
+                      Givaro::Integer alpha, Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::ConstElement_ptr A,
+                      const ParSeqHelper::Parallel<Cut,Param>& psH)
+    {
+        ParSeqHelper::Parallel<CuttingStrategy::Block,StrategyParameter::Threads> RowH(std::min(m,psH.numthreads()));
+        SYNCH_GROUP(
+                    FORBLOCK1D(iter, m, RowH,
+                               TASK(MODE(CONSTREFERENCE(F,alpha)),
+                                    fconvert_rns(F, iter.end()-iter.begin(), n, alpha, B+iter.begin()*ldb, ldb,
+                                                 typename FFPACK::RNSInteger<RNS>::Element_ptr(A._ptr+iter.begin()*n,A._stride),
+                                              ParSeqHelper::Sequential());
+                                   );
+                              );
+                   );
+    }
+    // a composed helper converts along its outer component
+    template<typename RNS, typename P1, typename P2>
+    void finit_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n, size_t k,
+                   const Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::Element_ptr A,
+                   const ParSeqHelper::Compose<P1,P2>& psH)
+    {
+        finit_rns(F,m,n,k,B,ldb,A,psH.first_component());
+    }
+    template<typename RNS, typename P1, typename P2>
+    void fconvert_rns(const FFPACK::RNSInteger<RNS> &F, const size_t m, const size_t n,
+                      Givaro::Integer alpha, Givaro::Integer *B, const size_t ldb, typename FFPACK::RNSInteger<RNS>::ConstElement_ptr A,
+                      const ParSeqHelper::Compose<P1,P2>& psH)
+    {
+        fconvert_rns(F,m,n,alpha,B,ldb,A,psH.first_component());
+    }
+
 
 } // end of namespace FFLAS
 
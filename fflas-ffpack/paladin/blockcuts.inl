@@ -52,6 +52,7 @@ namespace FFLAS {
         struct ThreeD{};
         struct ThreeDInPlace{};
         struct ThreeDAdaptive{};
+        struct TwoHalfD{};
     }
 
     /*! ParSeqHelper for both fgemm and ftrsm
@@ -65,6 +66,9 @@ namespace FFLAS {
             typedef P Param;
 
             Parallel(size_t n=NUM_THREADS):_numthreads(n){}
+            // same number of threads, with another strategy
+            template <typename C2, typename P2>
+            explicit Parallel(const Parallel<C2,P2>& p):_numthreads(p.numthreads()){}
 
             friend std::ostream& operator<<(std::ostream& out, const Parallel& p) {
                 return out << "Parallel: " << p.numthreads();
@@ -84,6 +84,33 @@ namespace FFLAS
                    );
     }
 
+    /** Allocates an m x n matrix of leading dimension n, zeroed in parallel
+     * along the 2D cut of par.
+     * Each block is first touched by a TASK_ON of its block index, as in the
+     * block parallel fgemm with the same helper: on NUMA nodes its pages land
+     * on the memory node of the thread that computes it. Under OpenMP, the
+     * call must be in a PAR_BLOCK for the blocks to be spread over the team.
+     */
+    template<class Field, class Cut, class Param>
+    inline typename Field::Element_ptr
+    fflas_new (const Field& F, const size_t m, const size_t n,
+               const ParSeqHelper::Parallel<Cut,Param> par,
+               const Alignment align = Alignment::DEFAULT)
+    {
+        typename Field::Element_ptr A = fflas_new (F, m, n, align);
+        SYNCH_GROUP(
+                    FORBLOCK2D(iter, m, n, par,
+                               TASK_ON(iter.blockindex(), MODE(CONSTREFERENCE(F, A)),
+                                       fzero(F,
+                                             iter.iend()-iter.ibegin(),
+                                             iter.jend()-iter.jbegin(),
+                                             A+iter.ibegin()*n+iter.jbegin(),
+                                             n);
+                                      );
+                              );
+                   );
+        return A;
+    }
 
     // #include <sstream>
 
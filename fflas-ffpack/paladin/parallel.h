@@ -30,7 +30,11 @@
 
 #include "fflas-ffpack/config.h"
 
-#ifndef __FFLASFFPACK_USE_OPENMP
+#ifdef __FFLASFFPACK_USE_THREADS
+#undef __FFLASFFPACK_USE_OPENMP
+#undef __FFLASFFPACK_USE_TBB
+#undef __FFLASFFPACK_USE_KAAPI
+#elif !defined(__FFLASFFPACK_USE_OPENMP)
 #define  __FFLASFFPACK_SEQUENTIAL
 #else
 #include "omp.h"
@@ -76,6 +80,7 @@
 #undef __FFLASFFPACK_USE_OPENMP
 #undef __FFLASFFPACK_USE_KAAPI
 #undef __FFLASFFPACK_USE_TBB
+#undef __FFLASFFPACK_USE_THREADS
 #define __FFLASFFPACK_SEQUENTIAL
 
 #endif
@@ -310,6 +315,13 @@ PRAGMA_OMP_IMPL(omp single)
 
 //////////////////////////////////////////////
 /////////////// dataflow macros //////////////
+// OpenMP 4.0 task dependencies are used by default: the READ/WRITE/READWRITE
+// modes of the tasks become depend clauses and CHECK_DEPENDENCIES no longer
+// waits. Define __FFLASFFPACK_NO_DATAFLOW to keep the explicit taskwaits.
+#if !defined(__FFLASFFPACK_USE_DATAFLOW) && !defined(__FFLASFFPACK_NO_DATAFLOW) && defined(_OPENMP) && (_OPENMP >= 201307)
+#define __FFLASFFPACK_USE_DATAFLOW
+#endif
+
 #ifdef __FFLASFFPACK_USE_DATAFLOW // OMP dataflow synch DSL features
 
 #define READ(Args...) depend(in: Args)
@@ -483,6 +495,124 @@ PARFORBLOCK2D(_internal_iterator, m, n, Helper,                     \
 
 #endif // end TBB macros
 
+/*********************************************************/
+/********************** STD::THREAD **********************/
+/*********************************************************/
+#ifdef __FFLASFFPACK_USE_THREADS
+
+#include "fflas-ffpack/paladin/threadpool.h"
+
+// same capture lists as TBB: the tasks are lambdas capturing by value,
+// except the CONSTREFERENCE arguments
+#define REF1(a) ,&a
+#define REF2(a,b) ,&a, &b
+#define REF3(a,b,c) ,&a,&b,&c
+#define REF4(a,b,c,d) ,&a,&b,&c,&d
+#define REF5(a,b,c,d,e) ,&a,&b,&c,&d,&e
+#define REF6(a,b,c,d,e,f) ,&a,&b,&c,&d,&e,&f
+#define REF7(a,b,c,d,e,f,g) ,&a,&b,&c,&d,&e,&f,&g
+#define REF8(a,b,c,d,e,f,g,h) ,&a,&b,&c,&d,&e,&f,&g,&h
+#define REF9(a,b,c,d,e,f,g,h,i) ,&a,&b,&c,&d,&e,&f,&g,&h,&i
+#define REF10(a,b,c,d,e,f,g,h,i,enough) ,&a,&b,&c,&d,&e,&f,&g,&h,&i,&enough
+#define GET_REF(_1,_2,_3,_4,_5,_6,_7,_8,_9,_10, NAME,...) NAME
+#define CONSTREFERENCE(...) GET_REF(__VA_ARGS__, REF10,REF9,REF8,REF7,REF6,REF5,REF4,REF3,REF2,REF1)(__VA_ARGS__)
+// values are captured by default
+#define VALUE(...)
+
+// a task group of the pool per SYNCH_GROUP, waited for at its end
+#define SYNCH_GROUP(Args...) \
+{FFLAS::TaskGroup g;  \
+    {{Args};}             \
+    g.wait();}
+
+#define TASK(M, I)                              \
+{                                           \
+    g.run([=M](){I;});			\
+}
+
+// the tasks of a block index go to the same thread of the pool
+#define TASK_ON(B, M, I)                        \
+{                                           \
+    g.runOn((B), [=M](){I;});		\
+}
+
+#define WAIT g.wait()
+#define CHECK_DEPENDENCIES g.wait()
+#define BARRIER
+#define PAR_BLOCK
+
+#define THREAD_INDEX FFLAS::ThreadPool::index()
+#define NUM_THREADS FFLAS::threadpool().size()
+#define MAX_THREADS FFLAS::threadpool().size()
+#define READ(Args...)
+#define WRITE(Args...)
+#define READWRITE(Args...)
+
+#define BEGIN_PARALLEL_MAIN(Args...) int main(Args)  {
+#define END_PARALLEL_MAIN(void)  return 0; }
+
+// for strategy 1D with access to the iterator
+#define FORBLOCK1D(iter, m, Helper, Args...)                            \
+{ FFLAS::ForStrategy1D<std::remove_const<decltype(m)>::type, typename decltype(Helper)::Cut, typename  decltype(Helper)::Param  > iter(m, Helper); \
+    for(iter.initialize(); !iter.isTerminated(); ++iter)            \
+    {Args;} }
+
+// for strategy 1D
+#define FOR1D(i, m, Helper, Args...)                                    \
+FORBLOCK1D(_internal_iterator, m, Helper,                           \
+           for(auto i=_internal_iterator.begin(); i!=_internal_iterator.end(); ++i) \
+           { Args; } )
+
+// parallel for 1D: a task per block, sharing the variables of the caller
+#define PARFORBLOCK1D(iter,  m, Helper, Args...)			\
+{ FFLAS::ForStrategy1D<std::remove_const<decltype(m)>::type, typename decltype(Helper)::Cut, typename  decltype(Helper)::Param> THRstrategyIterator(m, Helper); \
+    FFLAS::TaskGroup THRgroup;                                          \
+    for(THRstrategyIterator.initialize(); !THRstrategyIterator.isTerminated(); ++THRstrategyIterator) { \
+        const FFLAS::BlockRange<std::remove_const<decltype(m)>::type> iter(THRstrategyIterator.begin(), THRstrategyIterator.end()); \
+        THRgroup.runOn(THRstrategyIterator.blockindex(), [&, iter]() { {Args;} }); \
+    }                                                                   \
+    THRgroup.wait();                                                    \
+}
+
+#define PARFOR1D(i,  m, Helper, Args...)				\
+PARFORBLOCK1D(_internal_iterator, m, Helper,                        \
+              for(auto i=_internal_iterator.begin(); i!=_internal_iterator.end(); ++i) \
+              { Args; } )
+
+// for strategy 2D with access to the iterator
+#define FORBLOCK2D(iter, m, n, Helper, Args...)                         \
+{ FFLAS::ForStrategy2D<std::remove_const<decltype(m)>::type, typename decltype(Helper)::Cut, typename  decltype(Helper)::Param> iter(m,n,Helper); \
+    for(iter.initialize(); !iter.isTerminated(); ++iter)		\
+    {Args;} }
+
+// for strategy 2D
+#define FOR2D(i, j, m, n, Helper, Args...)                              \
+FORBLOCK2D(_internal_iterator, m, n, Helper,				\
+           for(auto i=_internal_iterator.ibegin(); i!=_internal_iterator.iend(); ++i) \
+           for(auto j=_internal_iterator.jbegin(); j!=_internal_iterator.jend(); ++j) \
+           { Args; })
+
+// parallel for strategy 2D with access to the range
+#define PARFORBLOCK2D(iter, m, n, Helper, Args...)                      \
+{ FFLAS::ForStrategy2D<std::remove_const<decltype(m)>::type, typename decltype(Helper)::Cut, typename  decltype(Helper)::Param> THRstrategyIterator(m,n,Helper); \
+    FFLAS::TaskGroup THRgroup;                                          \
+    for(THRstrategyIterator.initialize(); !THRstrategyIterator.isTerminated(); ++THRstrategyIterator) { \
+        const FFLAS::BlockRange2D<std::remove_const<decltype(m)>::type> iter(THRstrategyIterator.ibegin(), THRstrategyIterator.iend(), \
+                                                                             THRstrategyIterator.jbegin(), THRstrategyIterator.jend()); \
+        THRgroup.runOn(THRstrategyIterator.blockindex(), [&, iter]() { {Args;} }); \
+    }                                                                   \
+    THRgroup.wait();                                                    \
+}
+
+// parallel for strategy 2D
+#define PARFOR2D(i, j, m, n, Helper, Args...)                           \
+PARFORBLOCK2D(_internal_iterator, m, n, Helper,                     \
+              for(auto i=_internal_iterator.ibegin(); i!=_internal_iterator.iend(); ++i) \
+              for(auto j=_internal_iterator.jbegin(); j!=_internal_iterator.jend(); ++j) \
+              { Args; })
+
+#endif // end std::thread macros
+
 /*********************************************************/
 /************************* KAAPI *************************/
 /*********************************************************/
@@ -542,6 +672,13 @@ struct doit	{					\
 
 #define COMMA ,
 #define MODE(...)  __VA_ARGS__
+
+// a task of the block index B: the backends able to direct their tasks run
+// the blocks of the same index on the same thread, keeping first-touched
+// pages local; the others spawn a plain TASK
+#ifndef TASK_ON
+#define TASK_ON(B, M, I) TASK(M, I)
+#endif
 #define RETURNPARAM(f, P1, Args...) P1=f(Args)
 
 // Macro computes number of Arguments
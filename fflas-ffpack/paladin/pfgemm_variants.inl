@@ -49,7 +49,7 @@ namespace FFLAS
             size_t sa = (ta==FFLAS::FflasNoTrans)?lda:1;
             size_t sb = (tb==FFLAS::FflasNoTrans)?1:ldb;
             SYNCH_GROUP({FORBLOCK2D(iter,m,n,H.parseq,
-                                    TASK( MODE(
+                                    TASK_ON(iter.blockindex(), MODE(
                                                READ(A[iter.ibegin()*sa],B[iter.jbegin()*sb])
                                                CONSTREFERENCE(F, SeqH)
                                                READWRITE(C[iter.ibegin()*ldc+iter.jbegin()])),
@@ -149,7 +149,7 @@ namespace FFLAS
                         TASK(MODE(CONSTREFERENCE(F,H2) READ(A2,B2) READWRITE(C2)), pfgemm(F, ta, tb, m, n, k-K2, a, A2, lda, B2, ldb, F.zero, C2, n, H2));
                         CHECK_DEPENDENCIES;
 
-                        TASK(MODE(CONSTREFERENCE(F) READ(C2) READWRITE(C)),faddin(F, n, m, C2, n, C, ldc));
+                        TASK(MODE(CONSTREFERENCE(F) READ(C2) READWRITE(C)),pfaddin(F, m, n, C2, n, C, ldc, H.parseq.numthreads()));
 
                        );
             fflas_delete(C2);
@@ -478,7 +478,122 @@ namespace FFLAS
         return C;
     }
 
+    namespace Protected {
 
+        // T[0] += T[1] + ... + T[c-1] over G, by a tree of parallel additions:
+        // T[0] has leading dimension ld0, the others n
+        template<class AddField, class Element_ptr>
+        inline void pfgemm_sum_tree (const AddField& G, const size_t m, const size_t n,
+                                     Element_ptr* T, const size_t ld0, const size_t c, const size_t nt)
+        {
+            for (size_t s = 1; s < c; s <<= 1) {
+                const size_t share = std::max (size_t(1), nt / ((c - 1 - s) / (2*s) + 1));
+                SYNCH_GROUP(
+                            for (size_t i = 0; i + s < c; i += 2*s) {
+                            Element_ptr Ti = T[i];
+                            Element_ptr Ts = T[i+s];
+                            const size_t ldi = i ? n : ld0;
+                            TASK(MODE(CONSTREFERENCE(G) READ(Ts[0]) READWRITE(Ti[0])),
+                                 pfaddin (G, m, n, Ts, n, Ti, ldi, share));
+                            }
+                           );
+            }
+        }
+
+        template<class Field, class AlgoT, class FieldTrait, class ParSeq>
+        inline void pfgemm_sum_partials (const Field& F, MMHelper<Field, AlgoT, FieldTrait, ParSeq>& H,
+                                         const size_t m, const size_t n,
+                                         typename Field::Element_ptr* T, const size_t ld0, const size_t c, const size_t nt)
+        {
+            pfgemm_sum_tree (F, m, n, T, ld0, c, nt);
+        }
+
+        // delayed modes: the tree adds without reduction as long as the sum of
+        // the c reduced copies is storable, then a parallel freduce ends it
+        template<class Field, class AlgoT, class ParSeq>
+        inline void pfgemm_sum_partials (const Field& F, MMHelper<Field, AlgoT, ModeCategories::DelayedTag, ParSeq>& H,
+                                         const size_t m, const size_t n,
+                                         typename Field::Element_ptr* T, const size_t ld0, const size_t c, const size_t nt)
+        {
+            typedef typename MMHelper<Field, AlgoT, ModeCategories::DelayedTag, ParSeq>::DFElt DFElt;
+            const bool bounded = !(H.MaxStorableValue < DFElt(0));
+            if (bounded && std::max (static_cast<const DFElt&>(-H.FieldMin), H.FieldMax) > H.MaxStorableValue / DFElt(c)) {
+                pfgemm_sum_tree (F, m, n, T, ld0, c, nt);
+                return;
+            }
+            pfgemm_sum_tree (H.delayedField, m, n, T, ld0, c, nt);
+            pfreduce (F, m, n, T[0], ld0, nt);
+        }
+
+    } // Protected
+
+    /** 2.5D variant: k is cut into c slices, c being the replication factor
+     * (tuning().PfgemmReplication, or k/max(m,n) by default, within the workspace
+     * budget). Each slice is multiplied into its own copy of C by c-th of the
+     * threads with a 2D cutting of C, and the copies are summed by a parallel
+     * tree: c-1 temporaries of C for log(c) reduction steps.
+     */
+    template<class Field, class AlgoT, class FieldTrait>
+    typename Field::Element_ptr
+    pfgemm( const Field& F,
+            const FFLAS_TRANSPOSE ta,
+            const FFLAS_TRANSPOSE tb,
+            const size_t m,
+            const size_t n,
+            const size_t k,
+            const typename Field::Element alpha,
+            const typename Field::ConstElement_ptr A, const size_t lda,
+            const typename Field::ConstElement_ptr B, const size_t ldb,
+            const typename Field::Element beta,
+            typename Field::Element_ptr C, const size_t ldc,
+            MMHelper<Field, AlgoT, FieldTrait, ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoHalfD> > & H){
+
+        if (!m || !n) {return C;}
+        if (!k || F.isZero (alpha)){
+            fscalin(F, m, n, beta, C, ldc);
+            return C;
+        }
+        const size_t nt = H.parseq.numthreads();
+        if (nt <= 1 || std::min(m*n,std::min(m*k,k*n))<=__FFLASFFPACK_SEQPARTHRESHOLD*__FFLASFFPACK_SEQPARTHRESHOLD){
+            MMHelper<Field,AlgoT,FieldTrait,ParSeqHelper::Sequential> SeqH(H);
+            return fgemm(F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, SeqH);
+        }
+
+        size_t c = FFLAS::tuning().PfgemmReplication;
+        if (!c) c = k / std::max (m, n);
+        c = std::min (c - (c > 0), H.WorkspaceBudget / (m*n*sizeof(typename Field::Element))) + 1;
+        c = std::min (c, std::min (nt, k));
+
+        typedef MMHelper<Field, AlgoT, FieldTrait, ParSeqHelper::Parallel<CuttingStrategy::Recursive,StrategyParameter::TwoDAdaptive> > MMH_t;
+        MMH_t H2D(H);
+        if (c <= 1)
+            return pfgemm (F, ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, H2D);
+
+        std::vector<typename Field::Element_ptr> T (c, C);
+        for (size_t i = 1; i < c; ++i)
+            T[i] = fflas_new (F, m, n, Alignment::CACHE_PAGESIZE);
+        std::vector<MMH_t> Hs (c, H2D);
+        for (size_t i = 0; i < c; ++i)
+            Hs[i].parseq.set_numthreads (nt/c + ((i < nt%c) ? 1 : 0));
+
+        SYNCH_GROUP(
+                    for (size_t i = 0; i < c; ++i) {
+                    const size_t k0 = i*k/c;
+                    const size_t ki = (i+1)*k/c - k0;
+                    typename Field::ConstElement_ptr Ai = A + k0*((ta==FFLAS::FflasTrans)?lda:1);
+                    typename Field::ConstElement_ptr Bi = B + k0*((tb==FFLAS::FflasTrans)?1:ldb);
+                    typename Field::Element_ptr Ti = T[i];
+                    TASK(MODE(CONSTREFERENCE(F, Hs) READ(Ai[0], Bi[0]) READWRITE(Ti[0])),
+                         pfgemm (F, ta, tb, m, n, ki, alpha, Ai, lda, Bi, ldb,
+                                 i ? F.zero : beta, Ti, i ? n : ldc, Hs[i]));
+                    }
+                   );
+
+        Protected::pfgemm_sum_partials (F, H, m, n, T.data(), ldc, c, nt);
+        for (size_t i = 1; i < c; ++i)
+            fflas_delete (T[i]);
+        return C;
+    }
 
 } // FFLAS
 /* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
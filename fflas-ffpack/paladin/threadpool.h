@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file paladin/threadpool.h
+ * @brief Work-stealing thread pool of the std::thread paladin backend.
+ *
+ * Selected by __FFLASFFPACK_USE_THREADS, for programs that cannot link an
+ * OpenMP runtime. The pool is created at first use with
+ * FFLASFFPACK_NUM_THREADS threads (default: the hardware concurrency),
+ * counting the calling thread, which takes part in the work while it waits.
+ *
+ * Each worker owns a deque: it pushes and pops its tasks at the back, and
+ * steals from the front of the others when its own is empty. Tasks spawned
+ * from outside the pool go to a shared deque, stolen like the others.
+ * TaskGroup::wait runs pending tasks instead of blocking, so that nested
+ * SYNCH_GROUPs inside tasks never starve the pool.
+ *
+ * The tasks of a block index b (TASK_ON and the parallel loops) are queued
+ * on the deque of the thread b modulo the size of the pool: the blocks of
+ * the same index of successive loops and fgemm calls run on the same
+ * thread unless stolen, so that the pages first touched by a block stay
+ * local to it. With FFLASFFPACK_PIN_THREADS=1 (Linux), the workers are
+ * moreover pinned to CPUs spread evenly over the affinity mask of the
+ * process, hence over its NUMA nodes.
+ */
+
+#ifndef __FFLASFFPACK_paladin_threadpool_H
+#define __FFLASFFPACK_paladin_threadpool_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace FFLAS {
+
+    class ThreadPool {
+    public:
+        typedef std::function<void()> Task;
+
+        /// a pool of n threads, the calling one included, the workers pinned to CPUs if pin
+        explicit ThreadPool (size_t n, bool pin = false) :
+            _stop (false), _pending (0)
+        {
+            n = std::max (n, (size_t) 1);
+            for (size_t i = 0; i < n; ++i)
+                _queues.emplace_back (new Queue);
+#ifdef __linux__
+            cpu_set_t mask;
+            if (pin && !sched_getaffinity (0, sizeof (mask), &mask))
+                for (int c = 0; c < CPU_SETSIZE; ++c)
+                    if (CPU_ISSET (c, &mask)) _cpus.push_back (c);
+#endif
+            for (size_t i = 1; i < n; ++i)
+                _workers.emplace_back (&ThreadPool::work, this, i);
+        }
+
+        ~ThreadPool ()
+        {
+            {
+                std::lock_guard<std::mutex> lock (_sleepm);
+                _stop = true;
+            }
+            _sleepcv.notify_all();
+            for (auto& w : _workers)
+                w.join();
+        }
+
+        ThreadPool (const ThreadPool&) = delete;
+        ThreadPool& operator= (const ThreadPool&) = delete;
+
+        /// number of threads, the calling one included
+        size_t size () const { return _queues.size(); }
+
+        /// index of the current thread: 0 outside of the pool
+        static size_t& index ()
+        {
+            static thread_local size_t i = 0;
+            return i;
+        }
+
+        /// queues a task on the deque of the current thread
+        void push (Task&& t)
+        {
+            pushTo (index() < size() ? index() : 0, std::move (t));
+        }
+
+        /// queues a task on the deque of the thread i modulo the size of the pool
+        void pushTo (size_t i, Task&& t)
+        {
+            Queue& q = *_queues[i % size()];
+            {
+                std::lock_guard<std::mutex> lock (q.m);
+                q.tasks.push_back (std::move (t));
+            }
+            ++_pending;
+            _sleepcv.notify_one();
+        }
+
+        /// runs one pending task, if any: returns false when all the deques are empty
+        bool runOne ()
+        {
+            Task t;
+            const size_t i = index() < size() ? index() : 0;
+            if (!pop (i, t) && !steal (i, t))
+                return false;
+            t();
+            return true;
+        }
+
+    private:
+        struct Queue {
+            std::mutex m;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue> > _queues;
+        std::vector<std::thread> _workers;
+        std::vector<int> _cpus;
+        bool _stop;
+        std::atomic<size_t> _pending;
+        std::mutex _sleepm;
+        std::condition_variable _sleepcv;
+
+        bool pop (size_t i, Task& t)
+        {
+            Queue& q = *_queues[i];
+            std::lock_guard<std::mutex> lock (q.m);
+            if (q.tasks.empty()) return false;
+            t = std::move (q.tasks.back());
+            q.tasks.pop_back();
+            --_pending;
+            return true;
+        }
+
+        bool steal (size_t i, Task& t)
+        {
+            const size_t n = size();
+            for (size_t k = 1; k < n; ++k) {
+                Queue& q = *_queues[(i + k) % n];
+                std::unique_lock<std::mutex> lock (q.m, std::try_to_lock);
+                if (!lock.owns_lock() || q.tasks.empty()) continue;
+                t = std::move (q.tasks.front());
+                q.tasks.pop_front();
+                --_pending;
+                return true;
+            }
+            return false;
+        }
+
+        void work (size_t i)
+        {
+            index() = i;
+#ifdef __linux__
+            if (!_cpus.empty()) {
+                cpu_set_t c;
+                CPU_ZERO (&c);
+                CPU_SET (_cpus[i * _cpus.size() / size()], &c);
+                pthread_setaffinity_np (pthread_self(), sizeof (c), &c);
+            }
+#endif
+            for (;;) {
+                if (runOne()) continue;
+                std::unique_lock<std::mutex> lock (_sleepm);
+                if (_stop) return;
+                // the timeout covers the races between push and this check
+                _sleepcv.wait_for (lock, std::chrono::milliseconds (1),
+                                   [this] { return _stop || _pending.load() > 0; });
+                if (_stop) return;
+            }
+        }
+    };
+
+    /// the pool of the process, created at first use
+    inline ThreadPool& threadpool ()
+    {
+        static ThreadPool pool ([] {
+            const char* s = std::getenv ("FFLASFFPACK_NUM_THREADS");
+            const size_t n = (s && *s) ? std::strtoull (s, nullptr, 10) : 0;
+            return n ? n : (size_t) std::max (1u, std::thread::hardware_concurrency());
+        } (), [] {
+            const char* s = std::getenv ("FFLASFFPACK_PIN_THREADS");
+            return s && *s && *s != '0';
+        } ());
+        return pool;
+    }
+
+    /** A group of tasks of the pool, waited for together (the SYNCH_GROUP of
+     * the std::thread backend).
+     */
+    class TaskGroup {
+    public:
+        TaskGroup () : _count (0) {}
+        ~TaskGroup () { wait(); }
+
+        TaskGroup (const TaskGroup&) = delete;
+        TaskGroup& operator= (const TaskGroup&) = delete;
+
+        template<class F>
+        void run (const F& f)
+        {
+            ++_count;
+            threadpool().push ([this, f] () { f(); --_count; });
+        }
+
+        /// runs f on the thread of the block index b, see ThreadPool::pushTo
+        template<class F>
+        void runOn (size_t b, const F& f)
+        {
+            ++_count;
+            threadpool().pushTo (b, [this, f] () { f(); --_count; });
+        }
+
+        /// runs pending tasks of the pool until all the tasks of the group are done
+        void wait ()
+        {
+            ThreadPool& pool = threadpool();
+            while (_count.load())
+                if (!pool.runOne())
+                    std::this_thread::yield();
+        }
+
+    private:
+        std::atomic<size_t> _count;
+    };
+
+    /// range of a block of a parallel loop, as seen by its body
+    template<class T>
+    struct BlockRange {
+        BlockRange (T b, T e) : _b (b), _e (e) {}
+        T begin () const { return _b; }
+        T end () const { return _e; }
+    private:
+        T _b, _e;
+    };
+
+    template<class T>
+    struct BlockRange2D {
+        BlockRange2D (T ib, T ie, T jb, T je) : _ib (ib), _ie (ie), _jb (jb), _je (je) {}
+        T ibegin () const { return _ib; }
+        T iend () const { return _ie; }
+        T jbegin () const { return _jb; }
+        T jend () const { return _je; }
+    private:
+        T _ib, _ie, _jb, _je;
+    };
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_paladin_threadpool_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,426 @@
+/* utils/fflas_tuning.h
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file utils/fflas_tuning.h
+ * @brief Run-time tuning parameters derived from the cache topology.
+ *
+ * The thresholds of fflas-ffpack-default-thresholds.h are set at compile
+ * time, and are kept unless a profile or the environment gives other values.
+ * The Tuning object derives the blocking of the packed kernels from the
+ * cache sizes and core count of the machine actually running the code.
+ * The cores sharing the last level cache are read from the
+ * Linux sysfs, and default to all the hardware threads elsewhere. The
+ * values are computed once per process, at first use, and each of them can
+ * be overridden by an environment variable:
+ *
+ *  - FFLASFFPACK_L1_CACHE, FFLASFFPACK_L2_CACHE, FFLASFFPACK_L3_CACHE: cache sizes
+ *    in bytes (a k/K, m/M or g/G suffix is allowed)
+ *  - FFLASFFPACK_NUM_CORES: number of cores sharing the last level cache
+ *  - FFLASFFPACK_KC, FFLASFFPACK_MC, FFLASFFPACK_NC: packed fgemm blocking
+ *  - FFLASFFPACK_WINOTHRESHOLD, FFLASFFPACK_WINOTHRESHOLD_FLT,
+ *    FFLASFFPACK_WINOTHRESHOLD_BAL, FFLASFFPACK_WINOTHRESHOLD_BAL_FLT: Winograd cutoffs
+ *  - FFLASFFPACK_FTRSM_THRESHOLD: largest triangular block solved by ftrsm
+ *    before switching to an fgemm update, 0 (the default) for the bound of
+ *    the delayed reductions of the field only
+ *  - FFLASFFPACK_PLUQ_THRESHOLD, FFLASFFPACK_FTRTRI_THRESHOLD, FFLASFFPACK_FSYTRF_THRESHOLD,
+ *    FFLASFFPACK_FSYRK_THRESHOLD, FFLASFFPACK_ARITHPROG_THRESHOLD: ffpack cutoffs
+ *  - FFLASFFPACK_PLUQ_TILE: column tile width of the tiled parallel PLUQ
+ *  - FFLASFFPACK_PFGEMM_REPLICATION: number of copies of C of the 2.5D
+ *    parallel fgemm, 0 to derive it from the shape and the workspace budget
+ *  - FFLASFFPACK_EARLY_TERMINATION: number of extra primes that must leave the
+ *    multimodular Det and CharPoly over Z unchanged before they stop, 0 to
+ *    use all the primes of the a priori bound
+ *
+ * Between the derived values and the environment, the thresholds measured
+ * by the autotune programs are read from a profile file, named by
+ * FFLASFFPACK_PROFILE, or __FFLASFFPACK_PROFILE_PATH, or ~/.fflas-ffpack.profile.
+ * Each line of the profile is a tab separated record
+ *
+ *     cpu model <TAB> field <TAB> threads <TAB> parameter <TAB> value
+ *
+ * and only the records matching the cpu model and the thread count of the
+ * running process (or a '*' wildcard) are used. The field is '*' except for
+ * the WINOTHRESHOLD records, which may name one of the four fields having a
+ * Winograd cutoff of their own; other records are ignored.
+ */
+
+#ifndef __FFLASFFPACK_utils_fflas_tuning_H
+#define __FFLASFFPACK_utils_fflas_tuning_H
+
+#include "fflas-ffpack/fflas-ffpack-config.h"
+#include "fflas-ffpack/utils/fflas_memory.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#ifdef __FFLASFFPACK_USE_THREADS
+#include "fflas-ffpack/paladin/threadpool.h"
+#elif defined(__FFLASFFPACK_USE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace FFLAS {
+
+    struct Tuning {
+        size_t L1, L2, L3;  //!< cache sizes in bytes
+        size_t TLB;         //!< memory covered by the TLB in bytes, 0 if unknown
+        size_t cores;       //!< number of cores sharing L3
+        size_t kc, mc, nc;  //!< packed kernel blocking, 0 to derive it from the caches
+        size_t WinoThreshold, WinoThresholdFlt, WinoThresholdBal, WinoThresholdBalFlt;
+        size_t FtrsmThreshold;    //!< cap on the ftrsm blocks, 0 for none
+        size_t PluqThreshold, FtrtriThreshold, FsytrfThreshold, FsyrkThreshold, ArithProgThreshold;
+        size_t PluqTileSize;
+        size_t PfgemmReplication; //!< copies of C in the 2.5D pfgemm, 0 for automatic
+        size_t EarlyTermination;  //!< certifying primes of the multimodular Det and CharPoly, 0 for none
+
+        Tuning ()
+        {
+            int l1, l2, l3, tlb;
+            queryCacheSizes (l1, l2, l3);
+            getTLBSize (tlb);
+            L1 = (l1 > 0) ? size_t(l1) : 32768;
+            L2 = (l2 > 0) ? size_t(l2) : 262144;
+            L3 = (l3 > 0) ? size_t(l3) : L2;
+            TLB = (tlb > 0) ? size_t(tlb) : 0;
+            cores = sharedCores();
+            if (!cores) cores = std::max (1u, std::thread::hardware_concurrency());
+            kc = mc = nc = 0;
+            WinoThreshold = __FFLASFFPACK_WINOTHRESHOLD;
+            WinoThresholdFlt = __FFLASFFPACK_WINOTHRESHOLD_FLT;
+            WinoThresholdBal = __FFLASFFPACK_WINOTHRESHOLD_BAL;
+            WinoThresholdBalFlt = __FFLASFFPACK_WINOTHRESHOLD_BAL_FLT;
+            PluqThreshold = __FFLASFFPACK_PLUQ_THRESHOLD;
+            FtrtriThreshold = __FFLASFFPACK_FTRTRI_THRESHOLD;
+            FsytrfThreshold = __FFLASFFPACK_FSYTRF_THRESHOLD;
+            FsyrkThreshold = __FFLASFFPACK_FSYRK_THRESHOLD;
+            ArithProgThreshold = __FFLASFFPACK_ARITHPROG_THRESHOLD;
+            PfgemmReplication = 0;
+            EarlyTermination = 0;
+
+            readEnv ("FFLASFFPACK_L1_CACHE", L1);
+            readEnv ("FFLASFFPACK_L2_CACHE", L2);
+            readEnv ("FFLASFFPACK_L3_CACHE", L3);
+            readEnv ("FFLASFFPACK_NUM_CORES", cores);
+            cores = std::max (cores, size_t(1));
+
+            derive();
+            loadProfile();
+
+            readEnv ("FFLASFFPACK_KC", kc);
+            readEnv ("FFLASFFPACK_MC", mc);
+            readEnv ("FFLASFFPACK_NC", nc);
+            readEnv ("FFLASFFPACK_WINOTHRESHOLD", WinoThreshold);
+            readEnv ("FFLASFFPACK_WINOTHRESHOLD_FLT", WinoThresholdFlt);
+            readEnv ("FFLASFFPACK_WINOTHRESHOLD_BAL", WinoThresholdBal);
+            readEnv ("FFLASFFPACK_WINOTHRESHOLD_BAL_FLT", WinoThresholdBalFlt);
+            readEnv ("FFLASFFPACK_FTRSM_THRESHOLD", FtrsmThreshold);
+            readEnv ("FFLASFFPACK_PLUQ_THRESHOLD", PluqThreshold);
+            readEnv ("FFLASFFPACK_FTRTRI_THRESHOLD", FtrtriThreshold);
+            readEnv ("FFLASFFPACK_FSYTRF_THRESHOLD", FsytrfThreshold);
+            readEnv ("FFLASFFPACK_FSYRK_THRESHOLD", FsyrkThreshold);
+            readEnv ("FFLASFFPACK_ARITHPROG_THRESHOLD", ArithProgThreshold);
+            readEnv ("FFLASFFPACK_PLUQ_TILE", PluqTileSize);
+            readEnv ("FFLASFFPACK_PFGEMM_REPLICATION", PfgemmReplication);
+            readEnv ("FFLASFFPACK_EARLY_TERMINATION", EarlyTermination);
+        }
+
+        /** Share of the last level cache available to one core, in bytes.
+         * Capped to 8 times L2, beyond which larger blocks do not pay.
+         */
+        size_t LLCShare () const
+        {
+            return std::max (L2, std::min (L3 / cores, 8*L2));
+        }
+
+        /** \brief Blocking of a packed mr x nr micro-kernel on elements of type T.
+         * kc*nr elements fill half of L1, mc*kc half of L2 and kc*nc half of
+         * the share of the last level cache. Non zero kc, mc, nc override this.
+         */
+        template<class T>
+        void blocking (const size_t mr, const size_t nr, size_t& m, size_t& n, size_t& k) const
+        {
+            k = kc ? kc : std::max (size_t(16), L1 / (2*nr*sizeof(T)));
+            m = mc ? mc : std::max (mr, (L2 / (2*k*sizeof(T)) / mr) * mr);
+            n = nc ? nc : std::max (nr, (LLCShare() / (2*k*sizeof(T)) / nr) * nr);
+        }
+
+        /** \brief Number of physical cores sharing the last level cache of cpu 0, 0 if unknown.
+         * The cpus of the shared_cpu_list of its highest level cache in the Linux
+         * sysfs are counted once per set of hyperthread siblings.
+         */
+        static size_t sharedCores (const std::string& sys = "/sys/devices/system/cpu/")
+        {
+            std::string list;
+            int level = 0, l;
+            for (size_t i = 0; ; ++i) {
+                const std::string index = sys + "cpu0/cache/index" + std::to_string (i) + "/";
+                std::ifstream lf ((index + "level").c_str());
+                if (!(lf >> l)) break;
+                std::ifstream sf ((index + "shared_cpu_list").c_str());
+                std::string s;
+                if (l > level && (sf >> s)) {
+                    level = l;
+                    list = s;
+                }
+            }
+            std::vector<std::string> siblings;
+            for (auto c : parseCpuList (list)) {
+                std::ifstream tf ((sys + "cpu" + std::to_string (c) + "/topology/thread_siblings_list").c_str());
+                std::string t;
+                if (!(tf >> t)) t = std::to_string (c);
+                if (std::find (siblings.begin(), siblings.end(), t) == siblings.end())
+                    siblings.push_back (t);
+            }
+            return siblings.size();
+        }
+
+        /** \brief Cpus of a sysfs cpu list such as "0-3,8,10-11", empty if malformed.
+        */
+        static std::vector<size_t> parseCpuList (const std::string& list)
+        {
+            std::vector<size_t> cpus;
+            std::istringstream ls (list);
+            std::string range;
+            while (std::getline (ls, range, ',')) {
+                char* end;
+                const size_t a = std::strtoull (range.c_str(), &end, 10);
+                size_t b = a;
+                if (end == range.c_str()) return {};
+                if (*end == '-') {
+                    const char* s = end+1;
+                    b = std::strtoull (s, &end, 10);
+                    if (end == s || b < a) return {};
+                }
+                if (*end) return {};
+                for (size_t c = a; c <= b; ++c)
+                    cpus.push_back (c);
+            }
+            return cpus;
+        }
+
+        /** \brief Model name of the running cpu, as reported by CPUID or /proc/cpuinfo.
+        */
+        static std::string cpuModel ()
+        {
+            std::string model;
+#ifdef EIGEN_CPUID
+            int abcd[4];
+            EIGEN_CPUID(abcd,0x80000000,0);
+            if ((unsigned int)abcd[0] >= 0x80000004u) {
+                char brand[49] = {};
+                for (int i = 0; i < 3; ++i) {
+                    EIGEN_CPUID(abcd,0x80000002+i,0);
+                    std::memcpy (brand+16*i, abcd, 16);
+                }
+                model = brand;
+            }
+#endif
+            if (model.empty()) {
+                std::ifstream cpuinfo ("/proc/cpuinfo");
+                std::string line;
+                while (model.empty() && std::getline (cpuinfo, line))
+                    if (!line.compare (0, 10, "model name")) {
+                        size_t c = line.find (':');
+                        if (c != std::string::npos) model = line.substr (c+1);
+                    }
+            }
+            // trim, and turn tabs into spaces to keep the profile records parsable
+            std::replace (model.begin(), model.end(), '\t', ' ');
+            const size_t b = model.find_first_not_of (' ');
+            if (b == std::string::npos) return "unknown";
+            return model.substr (b, model.find_last_not_of (' ') - b + 1);
+        }
+
+        /** \brief Number of threads used by the running process, as keyed in the profile.
+        */
+        static size_t threads ()
+        {
+#ifdef __FFLASFFPACK_USE_THREADS
+            return threadpool().size();
+#elif defined(__FFLASFFPACK_USE_OPENMP)
+            return size_t (omp_get_max_threads());
+#else
+            return 1;
+#endif
+        }
+
+        /** \brief Path of the profile file, empty if none can be determined.
+        */
+        static std::string profilePath ()
+        {
+            const char* s = std::getenv ("FFLASFFPACK_PROFILE");
+            if (s && *s) return s;
+#ifdef __FFLASFFPACK_PROFILE_PATH
+            return __FFLASFFPACK_PROFILE_PATH;
+#else
+            const char* home = std::getenv ("HOME");
+            if (home && *home) return std::string(home) + "/.fflas-ffpack.profile";
+            return "";
+#endif
+        }
+
+        /** \brief Records a tuned parameter in the profile, for this cpu model and thread count.
+         * A previous record with the same key is replaced.
+         * \param param name of the parameter, e.g. "WINOTHRESHOLD"
+         * \param field name of the field it was tuned over, or "*" for every field
+         * \returns false if the profile could not be written, or if the
+         * parameter is not kept per field for this field name
+         */
+        static bool saveProfileEntry (const std::string& param, const std::string& field, const size_t value)
+        {
+            if (!fieldKey (param, field)) return false;
+            const std::string path = profilePath();
+            if (path.empty()) return false;
+            std::ostringstream key;
+            key << cpuModel() << '\t' << field << '\t' << threads() << '\t' << param << '\t';
+            std::vector<std::string> lines;
+            {
+                std::ifstream in (path.c_str());
+                std::string line;
+                while (std::getline (in, line))
+                    if (line.compare (0, key.str().size(), key.str()))
+                        lines.push_back (line);
+            }
+            if (lines.empty())
+                lines.push_back ("# fflas-ffpack tuning profile: cpu model, field, threads, parameter, value");
+            std::ofstream out (path.c_str(), std::ios::trunc);
+            if (!out) return false;
+            for (auto& l : lines)
+                out << l << '\n';
+            out << key.str() << value << '\n';
+            return bool(out);
+        }
+
+    private:
+        /** Derives the values with no compiled default from the local caches:
+         * the tiles of the tiled PLUQ are sized so that a tile of doubles fits
+         * in the share of the last level cache. The ftrsm blocks are only
+         * capped by a profile or the environment.
+         */
+        void derive ()
+        {
+            const size_t t = size_t (std::sqrt (double(LLCShare()) / sizeof(double)));
+            PluqTileSize = std::max (size_t(64), (t / 32) * 32);
+            FtrsmThreshold = 0;
+        }
+
+        /** Reads the records of the profile matching this cpu model and thread count.
+         * A record for the exact thread count takes precedence over a '*' one.
+         */
+        void loadProfile ()
+        {
+            const std::string path = profilePath();
+            if (path.empty()) return;
+            std::ifstream in (path.c_str());
+            if (!in) return;
+            const std::string model = cpuModel();
+            const std::string nt = std::to_string (threads());
+            std::vector<std::vector<std::string> > exact, wild;
+            std::string line;
+            while (std::getline (in, line)) {
+                if (line.empty() || line[0] == '#') continue;
+                std::vector<std::string> rec;
+                std::istringstream ls (line);
+                std::string f;
+                while (std::getline (ls, f, '\t'))
+                    rec.push_back (f);
+                if (rec.size() != 5 || rec[0] != model) continue;
+                if (rec[2] == nt) exact.push_back (rec);
+                else if (rec[2] == "*") wild.push_back (rec);
+            }
+            for (auto& rec : wild)
+                setProfileEntry (rec[1], rec[3], rec[4]);
+            for (auto& rec : exact)
+                setProfileEntry (rec[1], rec[3], rec[4]);
+        }
+
+        /// whether the profile can key this parameter by this field
+        static bool fieldKey (const std::string& param, const std::string& field)
+        {
+            if (field == "*") return true;
+            return param == "WINOTHRESHOLD"
+                && (field == "Givaro::Modular<double>" || field == "Givaro::Modular<float>"
+                    || field == "Givaro::ModularBalanced<double>" || field == "Givaro::ModularBalanced<float>");
+        }
+
+        void setProfileEntry (const std::string& field, const std::string& param, const std::string& value)
+        {
+            if (!fieldKey (param, field)) return;
+            char* end;
+            const size_t v = std::strtoull (value.c_str(), &end, 10);
+            if (end == value.c_str() || !v) return;
+            if (param == "WINOTHRESHOLD") {
+                if (field == "Givaro::Modular<double>" || field == "*") WinoThreshold = v;
+                if (field == "Givaro::Modular<float>" || field == "*") WinoThresholdFlt = v;
+                if (field == "Givaro::ModularBalanced<double>" || field == "*") WinoThresholdBal = v;
+                if (field == "Givaro::ModularBalanced<float>" || field == "*") WinoThresholdBalFlt = v;
+            }
+            else if (param == "KC") kc = v;
+            else if (param == "MC") mc = v;
+            else if (param == "NC") nc = v;
+            else if (param == "FTRSM_THRESHOLD") FtrsmThreshold = v;
+            else if (param == "PLUQ_THRESHOLD") PluqThreshold = v;
+            else if (param == "FTRTRI_THRESHOLD") FtrtriThreshold = v;
+            else if (param == "FSYTRF_THRESHOLD") FsytrfThreshold = v;
+            else if (param == "FSYRK_THRESHOLD") FsyrkThreshold = v;
+            else if (param == "ARITHPROG_THRESHOLD") ArithProgThreshold = v;
+            else if (param == "PLUQ_TILE") PluqTileSize = v;
+            else if (param == "PFGEMM_REPLICATION") PfgemmReplication = v;
+        }
+
+        static void readEnv (const char* name, size_t& val)
+        {
+            const char* s = std::getenv (name);
+            if (!s || !*s) return;
+            char* end;
+            unsigned long long v = std::strtoull (s, &end, 10);
+            if (end == s) return;
+            switch (*end) {
+            case 'g': case 'G': v <<= 10; // fall through
+            case 'm': case 'M': v <<= 10; // fall through
+            case 'k': case 'K': v <<= 10; break;
+            default: break;
+            }
+            val = size_t(v);
+        }
+    };
+
+    /** \brief The tuning parameters of the running process, computed at first call.
+    */
+    inline const Tuning& tuning ()
+    {
+        static const Tuning T;
+        return T;
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_utils_fflas_tuning_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,207 @@
+/* utils/fflas_workspace.h
+ * Copyright (C) 2026 the FFLAS-FFPACK group
+ *
+ * ========LICENCE========
+ * This file is part of the library FFLAS-FFPACK.
+ *
+ * FFLAS-FFPACK is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ *.
+ */
+
+/** @file utils/fflas_workspace.h
+ * @brief Caller-supplied arena for the temporaries of the recursive routines.
+ *
+ * The Strassen-Winograd schedules, fgemm_convert, the packed kernel and the
+ * delayed ftrsm allocate their temporaries at every recursion level. When a
+ * Workspace is attached to their MMHelper or TRSMHelper, these temporaries
+ * are taken from one aligned buffer instead, which the caller can size once
+ * with fgemm_workspace and reuse across calls. Requests that do not fit fall
+ * back to fflas_new, so an undersized arena is never an error.
+ *
+ * A Workspace is a stack: it is not thread safe, and the parallel routines
+ * only pass it to the tasks they run one after the other, or give each of
+ * their concurrent tasks a disjoint part of it (see BLAS3::WinoPar).
+ */
+
+#ifndef __FFLASFFPACK_workspace_H
+#define __FFLASFFPACK_workspace_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <type_traits>
+#include "fflas-ffpack/utils/fflas_memory.h"
+
+namespace FFLAS {
+
+    class Workspace {
+    public:
+        //! alignment of every block handed out
+        static const constexpr size_t alignment = (size_t)Alignment::CACHE_LINE;
+
+        //! An arena owning a buffer of \p bytes bytes
+        explicit Workspace (const size_t bytes) :
+            _buf(bytes ? malloc_align<char> (bytes, Alignment::CACHE_LINE) : nullptr),
+            _size(_buf ? bytes : 0), _top(0), _peak(0), _own(true) {}
+
+        //! An arena over the caller's buffer, which must outlive it
+        Workspace (void* buffer, const size_t bytes) :
+            _buf(static_cast<char*>(buffer)), _size(buffer ? bytes : 0), _top(0), _peak(0), _own(false) {}
+
+        ~Workspace () { if (_own) free (_buf); }
+
+        Workspace (const Workspace&) = delete;
+        Workspace& operator= (const Workspace&) = delete;
+
+        size_t size () const { return _size; }
+        //! bytes currently handed out, including alignment padding
+        size_t used () const { return _top; }
+        //! largest value of used() since construction or the last reset
+        size_t peak () const { return _peak; }
+        //! largest block that can still be allocated
+        size_t available () const
+        {
+            const size_t off = offset (_top);
+            return (off < _size) ? _size - off : 0;
+        }
+
+        //! A block of \p bytes bytes, or nullptr if it does not fit
+        void* allocate (const size_t bytes)
+        {
+            const size_t off = offset (_top);
+            if (!bytes || off > _size || bytes > _size - off)
+                return nullptr;
+            _blocks.push_back (Block {off, off+bytes, false});
+            _top = off + bytes;
+            _peak = std::max (_peak, _top);
+            return _buf + off;
+        }
+
+        /** Gives back a block of the arena, and returns false if \p p was not allocated by it.
+         * Blocks may be released in any order, their room is reclaimed once
+         * all the blocks allocated after them are released too.
+         */
+        bool release (const void* p)
+        {
+            const char* c = static_cast<const char*>(p);
+            if (!c || c < _buf || c >= _buf + _size)
+                return false;
+            const size_t off = (size_t)(c - _buf);
+            for (size_t i = _blocks.size(); i-- > 0; )
+                if (_blocks[i].begin == off) {
+                    _blocks[i].freed = true;
+                    break;
+                }
+            while (!_blocks.empty() && _blocks.back().freed)
+                _blocks.pop_back();
+            _top = _blocks.empty() ? 0 : _blocks.back().end;
+            return true;
+        }
+
+        //! Forgets every block, and the peak
+        void reset ()
+        {
+            _blocks.clear();
+            _top = _peak = 0;
+        }
+
+    private:
+        struct Block { size_t begin, end; bool freed; };
+
+        char* _buf;
+        size_t _size, _top, _peak;
+        bool _own;
+        std::vector<Block> _blocks;
+
+        size_t offset (const size_t top) const
+        {
+            // align the address, the caller's buffer may be less aligned than ours
+            const size_t a = (size_t)(reinterpret_cast<uintptr_t>(_buf) + top);
+            return top + ((alignment - a % alignment) % alignment);
+        }
+    };
+
+} // FFLAS
+
+namespace FFLAS { namespace Protected {
+
+    // Only plain arrays of trivially destructible elements can live in the arena
+    template<class Field>
+    struct WorkspaceAllocatable :
+    public std::integral_constant<bool, std::is_pointer<typename Field::Element_ptr>::value
+                                  && std::is_trivially_destructible<typename Field::Element>::value> {};
+
+    template<class Field>
+    inline typename Field::Element_ptr workspace_new (const Field& F, const size_t m, const size_t n, Workspace* W, std::true_type)
+    {
+        typedef typename Field::Element Element;
+        void* p = W ? W->allocate (m*n*sizeof(Element)) : nullptr;
+        return p ? static_cast<Element*>(p) : fflas_new (F, m, n);
+    }
+
+    template<class Field>
+    inline typename Field::Element_ptr workspace_new (const Field& F, const size_t m, const size_t n, Workspace*, std::false_type)
+    {
+        return fflas_new (F, m, n);
+    }
+
+} // Protected
+} // FFLAS
+
+namespace FFLAS {
+
+    /** An m x n matrix over F taken from \p W if not null and if it fits, from fflas_new otherwise.
+     * It is to be freed by workspace_delete with the same \p W.
+     */
+    template<class Field>
+    inline typename Field::Element_ptr workspace_new (const Field& F, const size_t m, const size_t n, Workspace* W)
+    {
+        return Protected::workspace_new (F, m, n, W, std::integral_constant<bool, Protected::WorkspaceAllocatable<Field>::value>());
+    }
+
+    //! m raw elements aligned for the SIMD kernels, taken from \p W if possible
+    template<class Element>
+    inline Element* workspace_new (const size_t m, const Alignment align, Workspace* W)
+    {
+        void* p = (W && (size_t)align <= Workspace::alignment) ? W->allocate (m*sizeof(Element)) : nullptr;
+        return p ? static_cast<Element*>(p) : fflas_new<Element> (m, align);
+    }
+
+    template<class Element>
+    inline void workspace_delete (Workspace* W, Element* A)
+    {
+        if (!W || !W->release (A))
+            fflas_delete (A);
+    }
+
+    template<class Element_ptr>
+    inline void workspace_delete (Workspace*, Element_ptr A)
+    {
+        fflas_delete (A);
+    }
+
+    template<class Ptr, class ...Args>
+    inline void workspace_delete (Workspace* W, Ptr p, Args ... args)
+    {
+        workspace_delete (W, p);
+        workspace_delete (W, std::forward<Args>(args)...);
+    }
+
+} // FFLAS
+
+#endif // __FFLASFFPACK_workspace_H
+/* -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,64 @@
+dnl turn on the std::thread paladin backend
+dnl  Copyright (c) 2026 FFLAS-FFPACK
+dnl ========LICENCE========
+dnl This file is part of the library FFLAS-FFPACK.
+dnl
+dnl FFLAS-FFPACK is free software: you can redistribute it and/or modify
+dnl it under the terms of the  GNU Lesser General Public
+dnl License as published by the Free Software Foundation; either
+dnl version 2.1 of the License, or (at your option) any later version.
+dnl
+dnl This library is distributed in the hope that it will be useful,
+dnl but WITHOUT ANY WARRANTY; without even the implied warranty of
+dnl MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+dnl Lesser General Public License for more details.
+dnl
+dnl You should have received a copy of the GNU Lesser General Public
+dnl License along with this library; if not, write to the Free Software
+dnl Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+dnl ========LICENCE========
+dnl
+
+dnl FF_CHECK_THREADS
+dnl
+dnl use the built-in std::thread work-stealing pool for the parallel
+dnl routines, instead of OpenMP (to be combined with --disable-openmp)
+
+AC_DEFUN([FF_CHECK_THREADS],
+	[ AC_ARG_ENABLE(threads,
+		[AC_HELP_STRING([--enable-threads],
+				[ Use the std::thread backend for the parallel routines ])
+		],
+		[ avec_threads=$enable_threads],
+		[ avec_threads=no ]
+		)
+	  AC_MSG_CHECKING(for the std::thread backend)
+	  AS_IF([ test "x$avec_threads" != "xno" ],
+		[
+		BACKUP_CXXFLAGS=${CXXFLAGS}
+		THREADSFLAGS="-pthread"
+		CXXFLAGS="${BACKUP_CXXFLAGS} ${THREADSFLAGS}"
+		AC_TRY_LINK([
+#include <thread>
+			],
+			[ std::thread t([]{}); t.join(); ],
+			[ threads_found="yes" ],
+			[ threads_found="no" ])
+		AS_IF(	[ test "x$threads_found" = "xyes" ],
+			[
+				AC_DEFINE(USE_THREADS,1,[Define to use the std::thread backend])
+				AC_SUBST(THREADSFLAGS)
+				AC_MSG_RESULT(yes)
+			],
+			[
+				THREADSFLAGS=
+				AC_SUBST(THREADSFLAGS)
+				AC_MSG_RESULT(no)
+			]
+		)
+		CXXFLAGS=${BACKUP_CXXFLAGS}
+		],
+		[ AC_MSG_RESULT(no) ]
+	)
+]
+)